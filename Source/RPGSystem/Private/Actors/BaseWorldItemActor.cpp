@@ -1,6 +1,9 @@
 ﻿#include "Actors/BaseWorldItemActor.h"
 #include "Inventory/ItemDataAsset.h"
+#include "Inventory/InventoryAssetManager.h"
+#include "Inventory/SyncLoadStats.h"
 #include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
 #include "Blueprint/UserWidget.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
@@ -52,19 +55,39 @@ void ABaseWorldItemActor::ApplyItemDataVisuals()
 
 	if (ItemData.IsNull())
 	{
+		ItemDataLoad.Reset();
 		Mesh->SetStaticMesh(nullptr);
 		return;
 	}
 
-	if (UItemDataAsset* Data = ItemData.LoadSynchronous())
+	UItemDataAsset* Data = ItemData.Get();
+	if (!Data)
 	{
-		if (UStaticMesh* M = Data->GetWorldMeshSync())
+		// Editor construction needs visuals immediately; in game the actor stays bare for the frames it takes to stream.
+		const UWorld* World = GetWorld();
+		if (!World || !World->IsGameWorld())
 		{
-			Mesh->SetStaticMesh(M);
+			Data = InventorySyncLoad::Load(ItemData, TEXT("WorldItem.ApplyItemDataVisuals"));
 		}
 		else
 		{
-			Mesh->SetStaticMesh(nullptr);
+			// With the World bundle, so the mesh below is already resident on clients (servers get Gameplay only).
+			const FSoftObjectPath Requested = ItemData.ToSoftObjectPath();
+			ItemDataLoad = UInventoryAssetManager::RequestItemBundles(ItemData, { UItemDataAsset::BundleWorld }, FItemDataResolvedDelegate::CreateWeakLambda(this, [this, Requested](UItemDataAsset* Loaded)
+			{
+				// Virtual, so weapon subclasses rebuild on top of the base visuals.
+				if (Loaded && ItemData.ToSoftObjectPath() == Requested) ApplyItemDataVisuals();
+			}));
+			return;
+		}
+	}
+
+	if (Data)
+	{
+		// Interaction traces run on clients, so a dedicated server leaves the visual mesh alone instead of loading it.
+		if (!IsRunningDedicatedServer())
+		{
+			Mesh->SetStaticMesh(Data->GetWorldMeshSync());
 		}
 		if (bUseEfficiency)
 		{
@@ -1,21 +1,70 @@
 ﻿#include "Actors/CampfireActor.h"
 #include "Components/SphereComponent.h"
+#include "FuelSystem/FuelComponent.h"
+#include "DecaySystem/DecayComponent.h"
+#include "GAS/RPGGameplayTags.h"
 
 ACampfireActor::ACampfireActor()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
+	// Overlap-only, for placed containers: entering/leaving the radius pushes warmth to decay components.
+	// Pawns are left to the heat field, which refreshes all players in one batch.
 	WarmthSphere = CreateDefaultSubobject<USphereComponent>(TEXT("WarmthSphere"));
 	WarmthSphere->SetupAttachment(GetRootComponent());
-	WarmthSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	WarmthSphere->SetGenerateOverlapEvents(false);
+	WarmthSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	WarmthSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+	WarmthSphere->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
+	WarmthSphere->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Overlap);
+	WarmthSphere->SetGenerateOverlapEvents(true);
 	WarmthSphere->SetSphereRadius(WarmthRadius);
+
+	// Warming and light are the campfire's job even with nothing cooking, so an idle station doesn't bank it.
+	if (FuelComponent)
+	{
+		FuelComponent->bAutoStopBurnWhenIdle = false;
+	}
 }
 
 void ACampfireActor::BeginPlay()
 {
+	// Before Super: the heat field registration reads these tags.
+	if (WarmthEnvironmentTags.IsEmpty())
+	{
+		WarmthEnvironmentTags.AddTag(TAG_Zone_Climate_Warm);
+	}
+
 	Super::BeginPlay();
 	UpdateWarmthRadius();
+
+	if (!HasAuthority()) return;
+
+	WarmthSphere->OnComponentBeginOverlap.AddDynamic(this, &ACampfireActor::OnWarmthBeginOverlap);
+	WarmthSphere->OnComponentEndOverlap  .AddDynamic(this, &ACampfireActor::OnWarmthEndOverlap);
+
+	if (FuelComponent)
+	{
+		FuelComponent->OnFuelActiveChanged.AddUObject(this, &ACampfireActor::HandleFuelActiveChanged);
+	}
+
+	if (IsWarming())
+	{
+		PushWarmthToOverlapping(true);
+	}
+}
+
+void ACampfireActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (HasAuthority())
+	{
+		PushWarmthToOverlapping(false);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+bool ACampfireActor::IsWarming() const
+{
+	return FuelComponent && FuelComponent->IsBurnActive();
 }
 
 void ACampfireActor::UpdateWarmthRadius()
@@ -26,6 +75,37 @@ void ACampfireActor::UpdateWarmthRadius()
 	}
 }
 
+void ACampfireActor::PushWarmthToOverlapping(bool bWarm)
+{
+	if (!WarmthSphere) return;
+
+	TArray<AActor*> Overlapping;
+	WarmthSphere->GetOverlappingActors(Overlapping);
+	for (AActor* Other : Overlapping)
+	{
+		if (!Other || Other == this) continue;
+		if (bWarm) UDecayComponent::NotifyEnvironmentEntered(Other, this, WarmthEnvironmentTags);
+		else       UDecayComponent::NotifyEnvironmentExited(Other, this);
+	}
+}
+
+void ACampfireActor::OnWarmthBeginOverlap(UPrimitiveComponent*, AActor* Other, UPrimitiveComponent*, int32, bool, const FHitResult&)
+{
+	if (!Other || Other == this || !IsWarming()) return;
+	UDecayComponent::NotifyEnvironmentEntered(Other, this, WarmthEnvironmentTags);
+}
+
+void ACampfireActor::OnWarmthEndOverlap(UPrimitiveComponent*, AActor* Other, UPrimitiveComponent*, int32)
+{
+	if (!Other || Other == this) return;
+	UDecayComponent::NotifyEnvironmentExited(Other, this);
+}
+
+void ACampfireActor::HandleFuelActiveChanged(bool bActive)
+{
+	PushWarmthToOverlapping(bActive);
+}
+
 #if WITH_EDITOR
 void ACampfireActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
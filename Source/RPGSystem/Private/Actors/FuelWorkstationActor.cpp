@@ -3,6 +3,7 @@
 #include "FuelSystem/FuelComponent.h"
 #include "Inventory/InventoryComponent.h"
 #include "Crafting/CraftingStationComponent.h"
+#include "FuelSystem/HeatFieldSubsystem.h"
 
 AFuelWorkstationActor::AFuelWorkstationActor()
 {
@@ -18,10 +19,51 @@ void AFuelWorkstationActor::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// If your UFuelComponent exposes a property for the inventory, wire it here.
-	// (Earlier errors showed no SetFuelInventory(), so skip unless you add one.)
-	// Example if you later add it:
-	// if (FuelComponent) { FuelComponent->SetFuelInventory(FuelInputInventory); }
+	if (FuelComponent && !FuelComponent->FuelInventory)
+	{
+		FuelComponent->SetFuelInventory(FuelInputInventory);
+	}
+
+	// Crafting only progresses while the fire burns; both sides push state changes to each other.
+	if (CraftingStation && FuelComponent)
+	{
+		CraftingStation->SetFuelSource(FuelComponent);
+	}
+
+	if (FuelComponent)
+	{
+		FuelComponent->OnFuelActiveChanged.AddUObject(this, &AFuelWorkstationActor::HandleHeatActiveChanged);
+	}
+	RefreshHeatSource();
+}
+
+void AFuelWorkstationActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UHeatFieldSubsystem* Heat = GetWorld() ? GetWorld()->GetSubsystem<UHeatFieldSubsystem>() : nullptr)
+	{
+		Heat->UnregisterSource(HeatSourceHandle);
+	}
+	HeatSourceHandle = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AFuelWorkstationActor::RefreshHeatSource()
+{
+	UHeatFieldSubsystem* Heat = GetWorld() ? GetWorld()->GetSubsystem<UHeatFieldSubsystem>() : nullptr;
+	if (!Heat) return;
+
+	Heat->UnregisterSource(HeatSourceHandle);
+	HeatSourceHandle = Heat->RegisterSource(this, GetHeatRadius(), HeatIntensity, GetHeatEnvironmentTags(),
+		FuelComponent && FuelComponent->IsBurnActive());
+}
+
+void AFuelWorkstationActor::HandleHeatActiveChanged(bool bActive)
+{
+	if (UHeatFieldSubsystem* Heat = GetWorld()->GetSubsystem<UHeatFieldSubsystem>())
+	{
+		Heat->SetSourceActive(HeatSourceHandle, bActive);
+	}
 }
 
 
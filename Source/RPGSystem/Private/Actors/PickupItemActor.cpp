@@ -3,6 +3,7 @@
 #include "Inventory/ItemDataAsset.h"
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/InventoryHelpers.h"
+#include "Inventory/SyncLoadStats.h"
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
@@ -27,7 +28,7 @@ void APickupItemActor::BeginPlay()
 
 	if (HasAuthority() && bEnableDecay && !ItemData.IsNull())
 	{
-		if (UItemDataAsset* Data = ItemData.LoadSynchronous())
+		if (UItemDataAsset* Data = InventorySyncLoad::Load(ItemData, TEXT("Pickup.BeginPlay")))
 		{
 			if (Data->bCanDecay)
 			{
@@ -74,11 +75,11 @@ void APickupItemActor::HandleDecayComplete()
 	DecayState = EPickupDecayState::Decayed;
 
 	// Transform into decayed actor/pickup if specified
-	if (UItemDataAsset* Data = ItemData.LoadSynchronous())
+	if (UItemDataAsset* Data = InventorySyncLoad::Load(ItemData, TEXT("Pickup.HandleDecayComplete")))
 	{
 		if (Data->DecaysIntoActorClass.ToSoftObjectPath().IsValid())
 		{
-			if (UClass* DecayedClass = Data->DecaysIntoActorClass.LoadSynchronous())
+			if (UClass* DecayedClass = InventorySyncLoad::Load(Data->DecaysIntoActorClass, TEXT("Pickup.HandleDecayComplete")))
 			{
 				FActorSpawnParameters Params;
 				Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
@@ -90,7 +91,7 @@ void APickupItemActor::HandleDecayComplete()
 					{
 						if (Data->DecaysInto.ToSoftObjectPath().IsValid())
 						{
-							if (UItemDataAsset* NewData = Data->DecaysInto.LoadSynchronous())
+							if (UItemDataAsset* NewData = InventorySyncLoad::Load(Data->DecaysInto, TEXT("Pickup.HandleDecayComplete")))
 							{
 								NewPickup->ItemData = NewData;
 							}
@@ -119,7 +120,7 @@ void APickupItemActor::HandleInteract_Server(AActor* Interactor)
 	UInventoryComponent* Inv = UInventoryHelpers::GetInventoryComponent(Interactor);
 	if (!Inv) return;
 
-	if (UItemDataAsset* Data = ItemData.LoadSynchronous())
+	if (UItemDataAsset* Data = InventorySyncLoad::Load(ItemData, TEXT("Pickup.HandleInteract")))
 	{
 		if (Inv->TryAddItem(Data, Quantity))
 		{
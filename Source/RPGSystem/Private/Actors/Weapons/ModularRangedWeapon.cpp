@@ -5,6 +5,7 @@
 #include "Inventory/RangedWeaponItemDataAsset.h"
 #include "Inventory/InventoryHelpers.h" // for FindItemDataByTag
 #include "Inventory/ItemDataAsset.h"
+#include "Inventory/SyncLoadStats.h"
 
 AModularRangedWeapon::AModularRangedWeapon()
 {
@@ -117,6 +118,11 @@ void AModularRangedWeapon::RebuildAllModVisuals()
 
 void AModularRangedWeapon::ApplyModVisual(const FInstalledWeaponMod& Mod)
 {
+	// Purely cosmetic; nothing to draw on a dedicated server.
+	if (IsRunningDedicatedServer()) return;
+
+	InventorySyncLoad::FCallSite Site(TEXT("ModularRangedWeapon.ApplyModVisual"));
+
 	// Resolve the mod item data
 	UItemDataAsset* ModItem = UInventoryHelpers::FindItemDataByTag(this, Mod.ModItemId);
 	if (!ModItem) return;
@@ -0,0 +1,326 @@
+// CraftPlannerSubsystem.cpp
+#include "Crafting/CraftPlannerSubsystem.h"
+#include "Crafting/CraftingRecipeDataAsset.h"
+#include "Crafting/RecipeCatalogSubsystem.h"
+#include "Inventory/InventoryComponent.h"
+#include "Engine/World.h"
+
+bool UCraftPlannerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && World->GetNetMode() != NM_Client;
+}
+
+void UCraftPlannerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (URecipeCatalogSubsystem* Catalog = URecipeCatalogSubsystem::Get())
+	{
+		CatalogBuiltHandle = Catalog->OnCatalogBuilt.AddUObject(this, &UCraftPlannerSubsystem::HandleCatalogBuilt);
+		if (Catalog->IsBuilt())
+		{
+			HandleCatalogBuilt();
+		}
+		else
+		{
+			Catalog->Preload();
+		}
+	}
+}
+
+void UCraftPlannerSubsystem::Deinitialize()
+{
+	if (URecipeCatalogSubsystem* Catalog = URecipeCatalogSubsystem::Get())
+	{
+		Catalog->OnCatalogBuilt.Remove(CatalogBuiltHandle);
+	}
+	CatalogBuiltHandle.Reset();
+	Super::Deinitialize();
+}
+
+void UCraftPlannerSubsystem::HandleCatalogBuilt()
+{
+	if (bExplicitRecipes) return;
+
+	URecipeCatalogSubsystem* Catalog = URecipeCatalogSubsystem::Get();
+	if (!Catalog) return;
+
+	TArray<UCraftingRecipeDataAsset*> All;
+	Catalog->GetAllRecipes(All);
+
+	Recipes.Reset(All.Num());
+	for (UCraftingRecipeDataAsset* Recipe : All)
+	{
+		if (Recipe) Recipes.Add(Recipe);
+	}
+	RebuildGraph();
+}
+
+void UCraftPlannerSubsystem::SetRecipes(const TArray<UCraftingRecipeDataAsset*>& NewRecipes)
+{
+	bExplicitRecipes = true;
+	Recipes.Reset(NewRecipes.Num());
+	for (UCraftingRecipeDataAsset* Recipe : NewRecipes)
+	{
+		if (Recipe) Recipes.AddUnique(Recipe);
+	}
+	RebuildGraph();
+}
+
+// --- Graph ---
+void UCraftPlannerSubsystem::RebuildGraph()
+{
+	const int32 N = Recipes.Num();
+
+	ProducersByTag.Reset();
+	ChoiceMemo.Reset();
+	TopoRank.Init(INDEX_NONE, N);
+	bInCycle.Init(false, N);
+
+	for (int32 i = 0; i < N; ++i)
+	{
+		for (const FCompiledRecipeItem& Out : Recipes[i]->GetCompiled().Outputs)
+		{
+			FProducer& P = ProducersByTag.FindOrAdd(Out.ItemIDTag).AddDefaulted_GetRef();
+			P.Recipe         = i;
+			P.OutputPerCraft = Out.Quantity;
+		}
+	}
+
+	// Edges consumer -> producers of its inputs.
+	TArray<TArray<int32>> DependsOn;
+	DependsOn.SetNum(N);
+	for (int32 i = 0; i < N; ++i)
+	{
+		for (const FCompiledRecipeItem& In : Recipes[i]->GetCompiled().Inputs)
+		{
+			if (const TArray<FProducer>* Producers = ProducersByTag.Find(In.ItemIDTag))
+			{
+				for (const FProducer& P : *Producers) DependsOn[i].AddUnique(P.Recipe);
+			}
+		}
+	}
+
+	// Tarjan SCC: a recipe is cyclic if its component has more than one member or it feeds itself.
+	TArray<int32> Index, Low, Stack;
+	TArray<bool> bOnStack;
+	Index.Init(INDEX_NONE, N);
+	Low.Init(0, N);
+	bOnStack.Init(false, N);
+	int32 Counter = 0;
+
+	TFunction<void(int32)> Connect = [&](int32 V)
+	{
+		Index[V] = Low[V] = Counter++;
+		Stack.Push(V);
+		bOnStack[V] = true;
+
+		for (const int32 W : DependsOn[V])
+		{
+			if (Index[W] == INDEX_NONE)
+			{
+				Connect(W);
+				Low[V] = FMath::Min(Low[V], Low[W]);
+			}
+			else if (bOnStack[W])
+			{
+				Low[V] = FMath::Min(Low[V], Index[W]);
+			}
+		}
+
+		if (Low[V] != Index[V]) return;
+
+		TArray<int32, TInlineAllocator<8>> Component;
+		int32 W;
+		do
+		{
+			W = Stack.Pop(EAllowShrinking::No);
+			bOnStack[W] = false;
+			Component.Add(W);
+		}
+		while (W != V);
+
+		const bool bCyclic = Component.Num() > 1 || DependsOn[V].Contains(V);
+		for (const int32 C : Component) bInCycle[C] = bCyclic;
+	};
+
+	for (int32 i = 0; i < N; ++i)
+	{
+		if (Index[i] == INDEX_NONE) Connect(i);
+	}
+
+	// Tarjan emits components dependencies-first, but ranks are assigned explicitly (Kahn) over the acyclic part.
+	TArray<int32> Pending;
+	Pending.Init(0, N);
+	TArray<TArray<int32>> Consumers;
+	Consumers.SetNum(N);
+	for (int32 i = 0; i < N; ++i)
+	{
+		if (bInCycle[i]) continue;
+		for (const int32 P : DependsOn[i])
+		{
+			if (bInCycle[P]) continue;
+			++Pending[i];
+			Consumers[P].Add(i);
+		}
+	}
+
+	TArray<int32> Ready;
+	for (int32 i = 0; i < N; ++i)
+	{
+		if (!bInCycle[i] && Pending[i] == 0) Ready.Add(i);
+	}
+
+	int32 Rank = 0;
+	for (int32 Head = 0; Head < Ready.Num(); ++Head)
+	{
+		const int32 R = Ready[Head];
+		TopoRank[R] = Rank++;
+		for (const int32 C : Consumers[R])
+		{
+			if (--Pending[C] == 0) Ready.Add(C);
+		}
+	}
+}
+
+const UCraftPlannerSubsystem::FTagChoice* UCraftPlannerSubsystem::ChooseProducer(const FGameplayTag& Tag, TArray<FGameplayTag>& Visiting) const
+{
+	if (const FTagChoice* Memo = ChoiceMemo.Find(Tag))
+	{
+		return Memo;
+	}
+	if (Visiting.Contains(Tag)) return nullptr;
+
+	FTagChoice Best;
+	if (const TArray<FProducer>* Producers = ProducersByTag.Find(Tag))
+	{
+		Visiting.Push(Tag);
+		for (const FProducer& P : *Producers)
+		{
+			if (bInCycle[P.Recipe] || P.OutputPerCraft <= 0) continue;
+
+			double Cost = 1.0;
+			for (const FCompiledRecipeItem& In : Recipes[P.Recipe]->GetCompiled().Inputs)
+			{
+				const FTagChoice* Sub = ChooseProducer(In.ItemIDTag, Visiting);
+				if (Sub) Cost += In.Quantity * Sub->CraftsPerUnit;
+			}
+			Cost /= P.OutputPerCraft;
+
+			if (Best.Recipe == INDEX_NONE || Cost < Best.CraftsPerUnit)
+			{
+				Best.Recipe         = P.Recipe;
+				Best.OutputPerCraft = P.OutputPerCraft;
+				Best.CraftsPerUnit  = Cost;
+			}
+		}
+		Visiting.Pop(EAllowShrinking::No);
+	}
+
+	// Raw materials memoize as Recipe == INDEX_NONE, cost 0.
+	return &ChoiceMemo.Add(Tag, Best);
+}
+
+void UCraftPlannerSubsystem::Expand(const FGameplayTag& Tag, int32 Need, TMap<FGameplayTag, int32>& Stock, TMap<int32, int32>& Crafts,
+	TMap<FGameplayTag, int32>& Missing, TArray<FGameplayTag>& Visiting) const
+{
+	// Owned (or already produced) stock first; only the shortfall is crafted.
+	int32& Have = Stock.FindOrAdd(Tag);
+	const int32 Take = FMath::Min(Have, Need);
+	Have -= Take;
+	Need -= Take;
+	if (Need <= 0) return;
+
+	TArray<FGameplayTag> ChoiceVisiting;
+	const FTagChoice* Choice = ChooseProducer(Tag, ChoiceVisiting);
+	if (!Choice || Choice->Recipe == INDEX_NONE || Visiting.Contains(Tag))
+	{
+		Missing.FindOrAdd(Tag) += Need;
+		return;
+	}
+
+	const int32 RecipeIdx = Choice->Recipe;
+	const FCompiledRecipe& Compiled = Recipes[RecipeIdx]->GetCompiled();
+	const int32 Times = FMath::DivideAndRoundUp(Need, Choice->OutputPerCraft);
+
+	Visiting.Push(Tag);
+	for (const FCompiledRecipeItem& In : Compiled.Inputs)
+	{
+		Expand(In.ItemIDTag, In.Quantity * Times, Stock, Crafts, Missing, Visiting);
+	}
+	Visiting.Pop(EAllowShrinking::No);
+
+	Crafts.FindOrAdd(RecipeIdx) += Times;
+
+	// Every output (byproducts and overshoot included) becomes stock for later lines.
+	for (const FCompiledRecipeItem& Out : Compiled.Outputs)
+	{
+		Stock.FindOrAdd(Out.ItemIDTag) += Out.Quantity * Times;
+	}
+	Stock.FindOrAdd(Tag) -= Need;
+}
+
+// --- Planning ---
+FCraftPlan UCraftPlannerSubsystem::PlanCraft(FGameplayTag TargetItemTag, int32 Quantity, const TArray<UInventoryComponent*>& Inventories) const
+{
+	const double Start = FPlatformTime::Seconds();
+
+	FCraftPlan Plan;
+	if (!TargetItemTag.IsValid() || Quantity <= 0) return Plan;
+
+	// Unreserved quantities by tag, so unloaded stacks count and in-flight jobs' inputs don't.
+	TMap<FGameplayTag, int32> Stock;
+	TSet<FGameplayTag> Counted;
+	for (const UInventoryComponent* Inv : Inventories)
+	{
+		if (!Inv) continue;
+		Counted.Reset();
+		for (const FInventoryItem& It : Inv->GetItems())
+		{
+			const FGameplayTag ItemID = It.IsValid() ? It.GetItemIDTag() : FGameplayTag();
+			if (!ItemID.IsValid()) continue;
+
+			bool bAlreadyCounted = false;
+			Counted.Add(ItemID, &bAlreadyCounted);
+			if (!bAlreadyCounted) Stock.FindOrAdd(ItemID) += Inv->GetAvailableQuantity(ItemID);
+		}
+	}
+
+	// The target itself is always crafted, not taken from stock.
+	Stock.Remove(TargetItemTag);
+
+	TMap<int32, int32> Crafts;
+	TMap<FGameplayTag, int32> Missing;
+	TArray<FGameplayTag> Visiting;
+	Expand(TargetItemTag, Quantity, Stock, Crafts, Missing, Visiting);
+
+	TArray<TPair<int32, int32>> Ordered = Crafts.Array();
+	Ordered.Sort([this](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return TopoRank[A.Key] < TopoRank[B.Key]; });
+
+	for (const TPair<int32, int32>& It : Ordered)
+	{
+		FCraftPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+		Step.Recipe = Recipes[It.Key];
+		Step.Times  = It.Value;
+	}
+
+	for (const TPair<FGameplayTag, int32>& It : Missing)
+	{
+		FCraftingItemQuantity& Line = Plan.Missing.AddDefaulted_GetRef();
+		Line.ItemIDTag = It.Key;
+		Line.Quantity  = It.Value;
+	}
+
+	for (int32 i = 0; i < Recipes.Num(); ++i)
+	{
+		if (bInCycle[i]) Plan.CyclicRecipes.Add(Recipes[i]);
+	}
+
+	Plan.bSuccess = Missing.Num() == 0 && Plan.Steps.Num() > 0;
+	Plan.PlanMilliseconds = static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0);
+
+	UE_LOG(LogTemp, Verbose, TEXT("[Crafting] Planned %d x %s: %d steps, %d missing, %.3f ms"),
+		Quantity, *TargetItemTag.ToString(), Plan.Steps.Num(), Plan.Missing.Num(), Plan.PlanMilliseconds);
+	return Plan;
+}
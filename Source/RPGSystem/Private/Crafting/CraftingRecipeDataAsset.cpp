@@ -1,5 +1,84 @@
 #include "Crafting/CraftingRecipeDataAsset.h"
+#include "Crafting/RecipeCatalogSubsystem.h"
+#include "Inventory/InventoryAssetManager.h"
 
+const FCompiledRecipe& UCraftingRecipeDataAsset::GetCompiled() const
+{
+	// An output dropped (or an input left unresolved) for a missing item would otherwise stay so for the session.
+	if (!Compiled.bCompiled || Compiled.bUnresolvedItems)
+	{
+		Compile();
+	}
+	return Compiled;
+}
 
+void UCraftingRecipeDataAsset::Compile() const
+{
+	const bool bRetry = Compiled.bUnresolvedItems;
+	Compiled = FCompiledRecipe();
+	Compiled.CraftSeconds        = FMath::Max(0.01f, CraftSeconds);
+	Compiled.RequiredStationTags = RequiredStationTags;
+	Compiled.UnlockTag           = UnlockTag;
 
+	// Paths only, from the tag index: compiling never loads an item. Outputs are streamed in by the station while the job runs.
+	const UInventoryAssetManager* AM = UInventoryAssetManager::GetOptional();
 
+	// Inputs are matched by tag in inventories, so an unresolved one is kept; it only marks the recipe for a retry.
+	for (const FCraftItemCost& In : Inputs)
+	{
+		if (!In.ItemIDTag.IsValid() || In.Quantity <= 0) continue;
+
+		FCompiledRecipeItem& Item = Compiled.Inputs.AddDefaulted_GetRef();
+		Item.ItemIDTag = In.ItemIDTag;
+		Item.Quantity  = In.Quantity;
+
+		FSoftObjectPath Path;
+		if (AM && AM->ResolveItemPathByTag(In.ItemIDTag, Path))
+		{
+			Item.Item = TSoftObjectPtr<UItemDataAsset>(Path);
+			continue;
+		}
+		if (!bRetry)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Crafting] %s: input %s has no item data; retried until it resolves."), *GetName(), *In.ItemIDTag.ToString());
+		}
+		Compiled.bUnresolvedItems = true;
+	}
+
+	for (const FCraftItemOutput& Out : Outputs)
+	{
+		if (!Out.ItemIDTag.IsValid() || Out.Quantity <= 0) continue;
+
+		FSoftObjectPath Path;
+		if (!AM || !AM->ResolveItemPathByTag(Out.ItemIDTag, Path))
+		{
+			if (!bRetry)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[Crafting] %s: output %s has no item data; skipped until it resolves."), *GetName(), *Out.ItemIDTag.ToString());
+			}
+			Compiled.bUnresolvedItems = true;
+			continue;
+		}
+
+		FCompiledRecipeItem& Item = Compiled.Outputs.AddDefaulted_GetRef();
+		Item.ItemIDTag = Out.ItemIDTag;
+		Item.Quantity  = Out.Quantity;
+		Item.Item      = TSoftObjectPtr<UItemDataAsset>(Path);
+	}
+
+	Compiled.bCompiled = true;
+}
+
+#if WITH_EDITOR
+void UCraftingRecipeDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	InvalidateCompiled();
+
+	// Tags and outputs feed the catalog's indices.
+	if (URecipeCatalogSubsystem* Catalog = URecipeCatalogSubsystem::Get())
+	{
+		Catalog->Invalidate();
+	}
+}
+#endif
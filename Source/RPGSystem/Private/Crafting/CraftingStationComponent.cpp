@@ -1,6 +1,7 @@
 // CraftingStationComponent.cpp
 #include "Crafting/CraftingStationComponent.h"
 #include "Crafting/CraftingRecipeDataAsset.h"
+#include "Crafting/CraftingStationRegistrySubsystem.h"
 #include "Net/UnrealNetwork.h"
 
 #include "GameplayTagAssetInterface.h"
@@ -8,297 +9,903 @@
 #include "AbilitySystemComponent.h"
 #include "GameplayTagContainer.h"
 
+#include "Inventory/InventoryAssetManager.h"
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/InventoryHelpers.h"
 #include "Inventory/ItemDataAsset.h"
+#include "Inventory/SyncLoadStats.h"
+#include "FuelSystem/FuelComponent.h"
 
-#include "UObject/UnrealType.h"
 #include "TimerManager.h"
+#include "GameFramework/GameStateBase.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 
-namespace
+void RPGCrafting_NetPostReplicated(UCraftingStationComponent* Owner)
 {
-	// Try to read float "CraftSeconds" from the recipe; default to a tiny value.
-	float GetRecipeDurationSeconds(const UCraftingRecipeDataAsset* Recipe, int32 Times)
+	if (Owner)
 	{
-		if (!Recipe) return 0.01f;
-		if (const FProperty* Prop = Recipe->GetClass()->FindPropertyByName(TEXT("CraftSeconds")))
-		{
-			if (const FFloatProperty* FProp = CastField<FFloatProperty>(Prop))
-			{
-				const float* Ptr = FProp->ContainerPtrToValuePtr<float>(Recipe);
-				if (Ptr) return FMath::Max(0.01f, *Ptr) * FMath::Max(1, Times);
-			}
-		}
-		return 0.01f * FMath::Max(1, Times);
+		Owner->HandleJobsReplicated();
+	}
+}
+
+UCraftingStationComponent::UCraftingStationComponent()
+{
+	SetIsReplicatedByDefault(true);
+	Jobs.Register(this);
+}
+
+void UCraftingStationComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UCraftingStationRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UCraftingStationRegistrySubsystem>())
+	{
+		RegistryHandle = Registry->RegisterStation(this);
+	}
+}
+
+void UCraftingStationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	SetFuelSource(nullptr);
+
+	if (UCraftingStationRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UCraftingStationRegistrySubsystem>() : nullptr)
+	{
+		Registry->UnregisterStation(RegistryHandle);
+	}
+	RegistryHandle = INDEX_NONE;
+
+	// Don't leave a crafter's items locked behind a station that is going away.
+	for (const FCraftingJob& Job : Jobs.Items)
+	{
+		ReleaseInputs(Job);
+	}
+
+	if (UWorld* W = GetWorld())
+	{
+		W->GetTimerManager().ClearTimer(CraftTimerHandle);
+	}
+	RecipePins.Reset();
+	if (OutputItemsLoad.IsValid())
+	{
+		OutputItemsLoad->CancelHandle();
+		OutputItemsLoad.Reset();
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void UCraftingStationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(UCraftingStationComponent, Jobs);
+	DOREPLIFETIME(UCraftingStationComponent, bIsCrafting);
+	DOREPLIFETIME(UCraftingStationComponent, bIsPaused);
+	DOREPLIFETIME(UCraftingStationComponent, bIsFuelStarved);
+	DOREPLIFETIME(UCraftingStationComponent, bIsDormant);
+}
+
+// --- Queue ---
+int32 UCraftingStationComponent::QueueCraft(AActor* InstigatorActor, const UCraftingRecipeDataAsset* Recipe, int32 Times)
+{
+	if (!HasAuth() || !Recipe || Times <= 0) return INDEX_NONE;
+	if (!InputInventory || !OutputInventory) return INDEX_NONE;
+	if (bIsDormant) CatchUp();
+	if (Jobs.Items.Num() >= MaxQueuedJobs) return INDEX_NONE;
+
+	// Inputs are reserved up front, so a queued job can never stall on missing materials;
+	// they stay in the crafter's inventory (unusable by anyone else) until the job gets a lane.
+	FCraftingJob Pending;
+	if (!ReserveInputs(Recipe, Times, InstigatorActor, Pending)) return INDEX_NONE;
+
+	FCraftingJob& Job = Jobs.Items.Add_GetRef(Pending);
+	Job.JobId            = NextJobId++;
+	Job.Recipe           = const_cast<UCraftingRecipeDataAsset*>(Recipe);
+	Job.Instigator       = InstigatorActor;
+	Job.Count            = Times;
+	Job.EndTime          = -1.f;
+	Job.RemainingSeconds = Recipe->GetCompiled().GetDurationSeconds(Times);
+	Jobs.MarkItemDirty(Job);
+
+	const int32 JobId = Job.JobId;
+
+	UpdateCraftingState();
+	StartQueuedJobs();
+	NotifyJobsChanged();
+	return JobId;
+}
+
+bool UCraftingStationComponent::StartCraftFromRecipe(AActor* InstigatorActor, const UCraftingRecipeDataAsset* Recipe, int32 Times)
+{
+	return QueueCraft(InstigatorActor, Recipe, Times) != INDEX_NONE;
+}
+
+bool UCraftingStationComponent::CancelJob(int32 JobId)
+{
+	if (!HasAuth()) return false;
+	if (bIsDormant) CatchUp();
+
+	const int32 Index = Jobs.Items.IndexOfByPredicate([JobId](const FCraftingJob& J) { return J.JobId == JobId; });
+	if (Index == INDEX_NONE) return false;
+
+	const FCraftingJob Cancelled = Jobs.Items[Index];
+	Jobs.Items.RemoveAt(Index);
+	Jobs.MarkArrayDirty();
+	ReleaseInputs(Cancelled);
+
+	StartQueuedJobs();
+	UpdateCraftingState();
+	ScheduleWakeup();
+
+	NotifyJobsChanged();
+	OnCraftFinished.Broadcast(Cancelled, false);
+	return true;
+}
+
+void UCraftingStationComponent::CancelCraft()
+{
+	if (!HasAuth()) return;
+	if (bIsDormant) CatchUp();
+	if (Jobs.Items.Num() == 0) return;
+
+	const TArray<FCraftingJob> Cancelled = MoveTemp(Jobs.Items);
+	Jobs.Items.Reset();
+	Jobs.MarkArrayDirty();
+	for (const FCraftingJob& Job : Cancelled)
+	{
+		ReleaseInputs(Job);
+	}
+
+	UpdateCraftingState();
+	ScheduleWakeup();
+
+	NotifyJobsChanged();
+	for (const FCraftingJob& Job : Cancelled)
+	{
+		OnCraftFinished.Broadcast(Job, false);
+	}
+}
+
+void UCraftingStationComponent::PauseCraft()
+{
+	if (!HasAuth()) return;
+	if (bIsDormant) CatchUp();
+	if (!bIsCrafting || bIsPaused) return;
+
+	bIsPaused = true;
+	UpdateJobClock();
+}
+
+void UCraftingStationComponent::ResumeCraft()
+{
+	if (!HasAuth() || !bIsPaused) return;
+	if (bIsDormant) CatchUp();
+
+	bIsPaused = false;
+	UpdateJobClock();
+}
+
+TArray<FCraftingJob> UCraftingStationComponent::GetJobs() const
+{
+	TArray<FCraftingJob> Ordered = Jobs.Items;
+	Ordered.Sort([](const FCraftingJob& A, const FCraftingJob& B) { return A.JobId < B.JobId; });
+	return Ordered;
+}
+
+bool UCraftingStationComponent::HasFreeLane() const
+{
+	int32 Started = 0;
+	for (const FCraftingJob& Job : Jobs.Items)
+	{
+		if (Job.IsStarted()) ++Started;
 	}
+	return Started < NumLanes;
+}
+
+float UCraftingStationComponent::GetJobRemainingSeconds(int32 JobId) const
+{
+	const FCraftingJob* Job = Jobs.Items.FindByPredicate([JobId](const FCraftingJob& J) { return J.JobId == JobId; });
+	if (!Job) return 0.f;
+	if (!Job->IsRunning()) return Job->RemainingSeconds;
+	return FMath::Max(0.f, Job->EndTime - GetServerTimeSeconds());
+}
+
+void UCraftingStationComponent::StartQueuedJobs()
+{
+	TArray<bool, TInlineAllocator<8>> LaneUsed;
+	LaneUsed.Init(false, FMath::Max(1, NumLanes));
 
-	// Extract (Tag, Amount) pairs from an array property named "Inputs" or "Outputs".
-	TArray<TPair<FGameplayTag,int32>> ExtractTagAmountArray(const UObject* Obj, const TCHAR* ArrayPropName)
+	int32 Busy = 0;
+	for (const FCraftingJob& Job : Jobs.Items)
 	{
-		TArray<TPair<FGameplayTag,int32>> Pairs;
-		if (!Obj) return Pairs;
+		if (!Job.IsStarted()) continue;
+		if (LaneUsed.IsValidIndex(Job.Lane)) LaneUsed[Job.Lane] = true;
+		++Busy;
+	}
+
+	const float Now = GetServerTimeSeconds();
+
+	// Lanes are claimed before any inventory changes, so a listener re-entering the queue sees them taken.
+	TArray<FPendingCommit, TInlineAllocator<8>> Claimed;
 
-		const FArrayProperty* ArrProp = FindFProperty<FArrayProperty>(Obj->GetClass(), ArrayPropName);
-		if (!ArrProp) return Pairs;
+	for (FCraftingJob& Job : Jobs.Items)
+	{
+		if (Busy >= LaneUsed.Num()) break;
+		if (Job.IsStarted()) continue;
+
+		Job.Lane      = LaneUsed.IndexOfByKey(false);
+		Job.StartTime = Now;
+		LaneUsed[Job.Lane] = true;
+		++Busy;
+
+		Claimed.Add({ Job.JobId, Job.ReservedFrom, Job.ReservationId });
+		Job.ReservedFrom.Reset();
+		Job.ReservationId = INDEX_NONE;
+		Jobs.MarkItemDirty(Job);
+	}
 
-		const void* ContainerPtr = ArrProp->ContainerPtrToValuePtr<void>(Obj);
-		FScriptArrayHelper Helper(ArrProp, ContainerPtr);
-		const FStructProperty* ElementStructProp = CastField<FStructProperty>(ArrProp->Inner);
-		if (!ElementStructProp) return Pairs;
+	if (Claimed.Num() == 0) return;
 
-		UScriptStruct* SS = ElementStructProp->Struct;
-		if (!SS) return Pairs;
+	// Second phase: the reserved inputs move into the station in one batch per job.
+	TArray<int32> StartedIds;
+	TArray<FCraftingJob> Failed;
+	CommitPending(Claimed, StartedIds, Failed);
 
-		for (int32 i = 0; i < Helper.Num(); ++i)
+	if (Failed.Num() > 0)
+	{
+		// The freed lanes go to the next jobs in line.
+		StartQueuedJobs();
+		BroadcastFailed(Failed);
+	}
+
+	if (StartedIds.Num() == 0) return;
+
+	UpdateJobClock();
+
+	// Copies: listeners may queue or cancel jobs while we broadcast.
+	for (const int32 Id : StartedIds)
+	{
+		if (const FCraftingJob* Job = Jobs.Items.FindByPredicate([Id](const FCraftingJob& J) { return J.JobId == Id; }))
 		{
-			void* ElemPtr = Helper.GetRawPtr(i);
+			const FCraftingJob Started = *Job;
+			OnCraftStarted.Broadcast(Started);
+		}
+	}
+}
 
-			FGameplayTag FoundTag;
-			int32 FoundAmount = 0;
+void UCraftingStationComponent::FinishDueJobs()
+{
+	if (!HasAuth()) return;
 
-			for (TFieldIterator<FProperty> It(SS); It; ++It)
-			{
-				if (const FStructProperty* SProp = CastField<FStructProperty>(*It))
-				{
-					if (SProp->Struct == TBaseStructure<FGameplayTag>::Get())
-					{
-						const FGameplayTag* TPtr = SProp->ContainerPtrToValuePtr<FGameplayTag>(ElemPtr);
-						if (TPtr && TPtr->IsValid())
-						{
-							FoundTag = *TPtr;
-						}
-						continue;
-					}
-				}
-				if (const FIntProperty* IProp = CastField<FIntProperty>(*It))
-				{
-					const FString Name = It->GetName().ToLower();
-					if (Name.Contains(TEXT("amount")) || Name.Contains(TEXT("count")) || Name.Contains(TEXT("quantity")))
-					{
-						if (const int32* V = IProp->ContainerPtrToValuePtr<int32>(ElemPtr))
-						{
-							FoundAmount = *V;
-						}
-					}
-				}
-			}
+	// The wakeup was set for this instant; the tolerance absorbs float rounding of server time.
+	const float Now = GetServerTimeSeconds() + 0.001f;
+
+	TArray<FCraftingJob> Finished;
+	for (const FCraftingJob& Job : Jobs.Items)
+	{
+		if (Job.IsRunning() && Job.EndTime <= Now) Finished.Add(Job);
+	}
+
+	if (Finished.Num() > 0)
+	{
+		Jobs.Items.RemoveAll([&Finished](const FCraftingJob& J)
+		{
+			return Finished.ContainsByPredicate([&J](const FCraftingJob& F) { return F.JobId == J.JobId; });
+		});
+		Jobs.MarkArrayDirty();
 
-			if (FoundTag.IsValid() && FoundAmount > 0)
+		DeliverJobOutputs(Finished);
+		for (const FCraftingJob& Job : Finished)
+		{
+			if (Job.Recipe)
 			{
-				Pairs.Emplace(FoundTag, FoundAmount);
+				GiveFinishXPIIfAny(Job.Recipe, Job.Instigator.Get(), true);
 			}
 		}
+	}
+
+	StartQueuedJobs();
+	UpdateCraftingState();
+	ScheduleWakeup();
 
-		return Pairs;
+	if (Finished.Num() > 0)
+	{
+		NotifyJobsChanged();
+		for (const FCraftingJob& Job : Finished)
+		{
+			OnCraftFinished.Broadcast(Job, Job.Recipe != nullptr);
+		}
 	}
+}
 
-	int32 CountItemsByItemTag(const UInventoryComponent* Inv, const FGameplayTag& ItemTag)
+void UCraftingStationComponent::NotifyJobsChanged()
+{
+	TArray<FSoftObjectPath, TInlineAllocator<8>> Paths;
+	TArray<TSoftObjectPtr<UItemDataAsset>> ColdOutputs;
+	for (const FCraftingJob& Job : Jobs.Items)
 	{
-		if (!Inv || !ItemTag.IsValid()) return 0;
-		int32 Total = 0;
-		const TArray<FInventoryItem>& Items = Inv->GetItems();
-		for (const FInventoryItem& It : Items)
+		Paths.Add(FSoftObjectPath(Job.Recipe.Get()));
+		if (!Job.Recipe) continue;
+
+		for (const FCompiledRecipeItem& Line : Job.Recipe->GetCompiled().Outputs)
 		{
-			if (!It.IsValid()) continue;
-			if (const UItemDataAsset* Data = It.ResolveItemData())
-			{
-				if (Data->ItemIDTag == ItemTag)
-				{
-					Total += It.Quantity;
-				}
-			}
+			Paths.Add(Line.Item.ToSoftObjectPath());
+			if (HasAuth() && Line.Item.IsPending()) ColdOutputs.AddUnique(Line.Item);
 		}
-		return Total;
 	}
+	RecipePins.Sync(Paths);
 
-	bool RemoveAndStage(UInventoryComponent* Source, UInventoryComponent* Input, const FGameplayTag& ItemTag, int32 Required)
+	// Only the server delivers; it streams the outputs while the job runs instead of loading them at the end.
+	if (ColdOutputs.Num() > 0)
 	{
-		if (!Source || !Input || !ItemTag.IsValid() || Required <= 0) return false;
+		OutputItemsLoad = UInventoryAssetManager::RequestItemDataBatch(ColdOutputs, FItemDataBatchResolvedDelegate());
+	}
+
+	OnJobsChanged.Broadcast();
+}
 
-		int32 Remaining = Required;
+void UCraftingStationComponent::HandleJobsReplicated()
+{
+	NotifyJobsChanged();
+}
 
-		if (CountItemsByItemTag(Source, ItemTag) < Required)
+void UCraftingStationComponent::CommitPending(TArrayView<const FPendingCommit> Pending, TArray<int32>& OutCommittedIds, TArray<FCraftingJob>& OutFailed)
+{
+	for (const FPendingCommit& Commit : Pending)
+	{
+		if (CommitInputs(Commit.Source.Get(), Commit.ReservationId))
 		{
-			return false;
+			OutCommittedIds.Add(Commit.JobId);
+			continue;
 		}
 
-		const TArray<FInventoryItem>& Items = Source->GetItems();
-		for (int32 i = 0; i < Items.Num() && Remaining > 0; ++i)
+		const int32 Index = Jobs.Items.IndexOfByPredicate([&Commit](const FCraftingJob& J) { return J.JobId == Commit.JobId; });
+		if (Index != INDEX_NONE)
 		{
-			const FInventoryItem& It = Items[i];
-			if (!It.IsValid()) continue;
+			OutFailed.Add(Jobs.Items[Index]);
+			Jobs.Items.RemoveAt(Index);
+			Jobs.MarkArrayDirty();
+		}
+	}
+}
+
+void UCraftingStationComponent::BroadcastFailed(const TArray<FCraftingJob>& Failed)
+{
+	UpdateCraftingState();
+	NotifyJobsChanged();
+	for (const FCraftingJob& Job : Failed)
+	{
+		OnCraftFinished.Broadcast(Job, false);
+	}
+}
 
-			UItemDataAsset* Data = It.ResolveItemData();
-			if (!Data || Data->ItemIDTag != ItemTag) continue;
+// --- Dormancy ---
+void UCraftingStationComponent::SetDormant(bool bDormant)
+{
+	if (!HasAuth() || bDormant == bIsDormant) return;
 
-			const int32 Take = FMath::Min(It.Quantity, Remaining);
+	if (bDormant)
+	{
+		bIsDormant   = true;
+		DormantSince = GetServerTimeSeconds();
 
-			if (Source->TryRemoveItem(i, Take))
-			{
-				Input->TryAddItem(Data, Take);
-				Remaining -= Take;
-			}
-		}
+		// Freezes every job clock and clears the wakeup timer.
+		UpdateJobClock();
+		StageReservedInputs();
 
-		return Remaining == 0;
+		// Bank the fire; its burn is settled together with the jobs.
+		if (FuelSource) FuelSource->PauseBurn();
+		return;
 	}
+
+	CatchUp();
+	bIsDormant = false;
+
+	bIsFuelStarved = false;
+	if (FuelSource && bIsCrafting)
+	{
+		FuelSource->OnCraftingActivated();
+		bIsFuelStarved = !FuelSource->IsBurnActive();
+	}
+
+	StartQueuedJobs();
+	UpdateJobClock();
 }
 
-UCraftingStationComponent::UCraftingStationComponent()
+int32 UCraftingStationComponent::CatchUp()
 {
-	SetIsReplicatedByDefault(true);
+	if (!HasAuth() || !bIsDormant) return 0;
+
+	const float Now = GetServerTimeSeconds();
+	const float Elapsed = Now - DormantSince;
+	DormantSince = Now;
+	return SimulateElapsed(Elapsed);
 }
 
-void UCraftingStationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+bool UCraftingStationComponent::ProgressesWhileDormant(const FCraftingJob& Job)
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(UCraftingStationComponent, ActiveJob);
-	DOREPLIFETIME(UCraftingStationComponent, bIsCrafting);
-	DOREPLIFETIME(UCraftingStationComponent, bIsPaused);
+	// A dormant station has nobody at it, so jobs that need their crafter present wait for wake.
+	return Job.Recipe && Job.Recipe->PresencePolicy != ECraftPresencePolicy::CrafterMustRemain;
 }
 
-bool UCraftingStationComponent::StartCraftFromRecipe(AActor* InstigatorActor, const UCraftingRecipeDataAsset* Recipe, int32 Times)
+void UCraftingStationComponent::StageReservedInputs()
 {
-	if (!HasAuth() || bIsCrafting || !Recipe || Times <= 0) return false;
-	if (!InputInventory || !OutputInventory) return false;
+	TArray<FPendingCommit, TInlineAllocator<8>> Held;
+	for (FCraftingJob& Job : Jobs.Items)
+	{
+		if (Job.IsStarted() || Job.ReservationId == INDEX_NONE) continue;
 
-	if (!MoveRequiredToInput(Recipe, Times, InstigatorActor)) return false;
+		Held.Add({ Job.JobId, Job.ReservedFrom, Job.ReservationId });
+		Job.ReservedFrom.Reset();
+		Job.ReservationId = INDEX_NONE;
+	}
+	if (Held.Num() == 0) return;
 
-	ActiveJob = FCraftingJob{};
-	ActiveJob.Recipe     = const_cast<UCraftingRecipeDataAsset*>(Recipe);
-	ActiveJob.Instigator = InstigatorActor;
-	ActiveJob.Count      = Times;
-	ActiveJob.StartTime  = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+	TArray<int32> Staged;
+	TArray<FCraftingJob> Failed;
+	CommitPending(Held, Staged, Failed);
 
-	const float TotalDuration = GetRecipeDurationSeconds(Recipe, Times);
-	ActiveJob.EndTime         = ActiveJob.StartTime + TotalDuration;
+	if (Failed.Num() > 0)
+	{
+		BroadcastFailed(Failed);
+	}
+}
 
-	bIsCrafting = true;
-	bIsPaused   = false;
-	OnCraftStarted.Broadcast(ActiveJob);
+int32 UCraftingStationComponent::SimulateElapsed(float ElapsedSeconds)
+{
+	if (!HasAuth() || !bIsDormant || ElapsedSeconds <= 0.f) return 0;
 
-	GetWorld()->GetTimerManager().SetTimer(
-		CraftTimerHandle,
-		this, &UCraftingStationComponent::FinishCraft_Internal,
-		TotalDuration,
-		false
-	);
+	StageReservedInputs();
+	if (Jobs.Items.Num() == 0) return 0;
 
-	return true;
+	// Horizon: a paused station stays banked; a fuel-gated one runs only as long as the fuel it holds,
+	// then sits starved for the rest of the span (nobody refuels an unattended station).
+	float Horizon = bIsPaused ? 0.f : ElapsedSeconds;
+	if (FuelSource)
+	{
+		Horizon = FMath::Min(Horizon, FuelSource->GetAvailableBurnSeconds());
+	}
+
+	// Lane schedule as offsets into the span. Lanes held by jobs that can't progress stay blocked.
+	struct FSimJob
+	{
+		int32 Lane = INDEX_NONE;
+		float Start = 0.f;
+		float Finish = -1.f;
+	};
+	TArray<FSimJob> Sim;
+	Sim.SetNum(Jobs.Items.Num());
+
+	TArray<float, TInlineAllocator<8>> LaneFree;
+	LaneFree.Init(0.f, FMath::Max(1, NumLanes));
+
+	for (int32 i = 0; i < Jobs.Items.Num(); ++i)
+	{
+		const FCraftingJob& Job = Jobs.Items[i];
+		if (!Job.IsStarted() || !LaneFree.IsValidIndex(Job.Lane)) continue;
+
+		if (!ProgressesWhileDormant(Job))
+		{
+			LaneFree[Job.Lane] = TNumericLimits<float>::Max();
+			continue;
+		}
+		Sim[i].Lane   = Job.Lane;
+		Sim[i].Finish = Job.RemainingSeconds;
+		LaneFree[Job.Lane] = Job.RemainingSeconds;
+	}
+
+	for (int32 i = 0; i < Jobs.Items.Num(); ++i)
+	{
+		const FCraftingJob& Job = Jobs.Items[i];
+		if (Job.IsStarted() || !ProgressesWhileDormant(Job)) continue;
+
+		int32 Lane = 0;
+		for (int32 L = 1; L < LaneFree.Num(); ++L)
+		{
+			if (LaneFree[L] < LaneFree[Lane]) Lane = L;
+		}
+
+		// FIFO: once the earliest lane frees past the horizon, nothing later starts either.
+		if (LaneFree[Lane] >= Horizon) break;
+
+		Sim[i].Lane   = Lane;
+		Sim[i].Start  = LaneFree[Lane];
+		Sim[i].Finish = LaneFree[Lane] + Job.RemainingSeconds;
+		LaneFree[Lane] = Sim[i].Finish;
+	}
+
+	const float SpanStart = GetServerTimeSeconds() - ElapsedSeconds;
+	float BusySeconds = 0.f;
+	bool bProgressed = false;
+	TArray<FCraftingJob> Started;
+	TArray<FCraftingJob> Finished;
+
+	for (int32 i = 0; i < Jobs.Items.Num(); ++i)
+	{
+		const FSimJob& S = Sim[i];
+		if (S.Finish < 0.f || S.Start >= Horizon) continue;
+
+		// Lanes start at 0 and never idle while work is left, so the station is busy for one unbroken stretch.
+		BusySeconds = FMath::Max(BusySeconds, FMath::Min(S.Finish, Horizon));
+		bProgressed = true;
+
+		FCraftingJob& Job = Jobs.Items[i];
+		if (!Job.IsStarted())
+		{
+			Job.Lane      = S.Lane;
+			Job.StartTime = SpanStart + S.Start;
+			Started.Add(Job);
+		}
+
+		if (S.Finish <= Horizon + KINDA_SMALL_NUMBER)
+		{
+			Finished.Add(Job);
+			continue;
+		}
+		Job.RemainingSeconds = S.Finish - Horizon;
+		Jobs.MarkItemDirty(Job);
+	}
+
+	if (!bProgressed) return 0;
+
+	if (Finished.Num() > 0)
+	{
+		Jobs.Items.RemoveAll([&Finished](const FCraftingJob& J)
+		{
+			return Finished.ContainsByPredicate([&J](const FCraftingJob& F) { return F.JobId == J.JobId; });
+		});
+		Jobs.MarkArrayDirty();
+	}
+
+	// Burn exactly the stretch the station was busy, then bank the fire again.
+	if (FuelSource && BusySeconds > 0.f)
+	{
+		FuelSource->OnCraftingActivated();
+		FuelSource->CatchUpBurn(BusySeconds);
+		FuelSource->PauseBurn();
+	}
+
+	DeliverJobOutputs(Finished);
+	for (const FCraftingJob& Job : Finished)
+	{
+		GiveFinishXPIIfAny(Job.Recipe, Job.Instigator.Get(), true);
+	}
+
+	UpdateCraftingState();
+
+	if (AActor* Owner = GetOwner())
+	{
+		Owner->ForceNetUpdate();
+	}
+
+	NotifyJobsChanged();
+	for (const FCraftingJob& Job : Started)
+	{
+		OnCraftStarted.Broadcast(Job);
+	}
+	for (const FCraftingJob& Job : Finished)
+	{
+		OnCraftFinished.Broadcast(Job, true);
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("[Crafting] %s caught up %.1fs (%.1fs busy): %d jobs finished"),
+		*GetNameSafe(GetOwner()), ElapsedSeconds, BusySeconds, Finished.Num());
+	return Finished.Num();
 }
 
-void UCraftingStationComponent::CancelCraft()
+FCraftingStationSnapshot UCraftingStationComponent::MakeSnapshot()
 {
-	if (!HasAuth() || !bIsCrafting) return;
+	FCraftingStationSnapshot Snapshot;
+	if (!HasAuth()) return Snapshot;
 
-	GetWorld()->GetTimerManager().ClearTimer(CraftTimerHandle);
-	bIsCrafting = false;
-	bIsPaused   = false;
+	SetDormant(true);
+	CatchUp();
 
-	OnCraftFinished.Broadcast(ActiveJob, false);
-	ActiveJob = FCraftingJob{};
+	Snapshot.Jobs            = Jobs.Items;
+	Snapshot.SavedServerTime = DormantSince;
+	Snapshot.NextJobId       = NextJobId;
+	Snapshot.bPaused         = bIsPaused;
+	return Snapshot;
 }
 
-void UCraftingStationComponent::PauseCraft()
+int32 UCraftingStationComponent::RestoreSnapshot(const FCraftingStationSnapshot& Snapshot, float ElapsedSeconds)
 {
-	if (!HasAuth() || !bIsCrafting || bIsPaused) return;
+	if (!HasAuth()) return 0;
 
-	bIsPaused = true;
+	// The snapshot replaces whatever the station holds now.
+	for (const FCraftingJob& Job : Jobs.Items)
+	{
+		ReleaseInputs(Job);
+	}
+	Jobs.Items.Reset();
+	SetDormant(true);
 
-	const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
-	const float Remaining = FMath::Max(0.f, ActiveJob.EndTime - Now);
-	ActiveJob.EndTime = Now + Remaining;
+	for (const FCraftingJob& Saved : Snapshot.Jobs)
+	{
+		FCraftingJob& Job = Jobs.Items.Add_GetRef(Saved);
+
+		// Fresh replication identity; the saved one belonged to another actor instance.
+		Job.ReplicationID  = INDEX_NONE;
+		Job.ReplicationKey = INDEX_NONE;
+		Job.EndTime        = -1.f;
+		if (Job.Lane >= NumLanes) Job.Lane = INDEX_NONE;
+		Jobs.MarkItemDirty(Job);
+	}
+	Jobs.MarkArrayDirty();
+
+	NextJobId = FMath::Max(NextJobId, Snapshot.NextJobId);
+	bIsPaused = Snapshot.bPaused;
+	UpdateCraftingState();
+
+	const float Now = GetServerTimeSeconds();
+	DormantSince = Now;
+
+	const float Elapsed = ElapsedSeconds >= 0.f ? ElapsedSeconds : FMath::Max(0.f, Now - Snapshot.SavedServerTime);
+	const int32 Completed = SimulateElapsed(Elapsed);
 
-	GetWorld()->GetTimerManager().ClearTimer(CraftTimerHandle);
+	SetDormant(false);
+	return Completed;
 }
 
-void UCraftingStationComponent::ResumeCraft()
+// --- Clock ---
+void UCraftingStationComponent::UpdateCraftingState()
 {
-	if (!HasAuth() || !bIsCrafting || !bIsPaused) return;
+	const bool bBusy = Jobs.Items.Num() > 0;
+	if (bBusy == bIsCrafting) return;
 
-	bIsPaused = false;
+	bIsCrafting = bBusy;
 
-	const float Now      = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
-	const float TimeLeft = FMath::Max(0.01f, ActiveJob.EndTime - Now);
+	// Dormant stations settle fuel in CatchUp instead.
+	if (!FuelSource || bIsDormant) return;
 
-	GetWorld()->GetTimerManager().SetTimer(
-		CraftTimerHandle,
-		this, &UCraftingStationComponent::FinishCraft_Internal,
-		TimeLeft,
-		false
-	);
+	if (bBusy)
+	{
+		// Lights (or un-pauses) the fire if there is fuel; its active event may already clear starvation.
+		FuelSource->OnCraftingActivated();
+		bIsFuelStarved = !FuelSource->IsBurnActive();
+	}
+	else
+	{
+		// Nothing left to heat: let the fire bank itself instead of burning fuel for an idle station.
+		bIsFuelStarved = false;
+		FuelSource->OnCraftingDeactivated();
+	}
 }
 
-void UCraftingStationComponent::FinishCraft_Internal()
+void UCraftingStationComponent::SetFuelSource(UFuelComponent* NewFuelSource)
 {
-	const bool bSuccess = (ActiveJob.Recipe != nullptr);
+	if (NewFuelSource == FuelSource) return;
 
-	if (bSuccess)
+	if (FuelSource)
 	{
-		DeliverOutputs(ActiveJob.Recipe);
-		GiveFinishXPIIfAny(ActiveJob.Recipe, ActiveJob.Instigator.Get(), true);
+		FuelSource->OnFuelActiveChanged.RemoveAll(this);
+		FuelSource->SetLinkedStation(nullptr);
+	}
+
+	FuelSource = NewFuelSource;
+	if (!FuelSource)
+	{
+		if (HasAuth() && bIsFuelStarved)
+		{
+			bIsFuelStarved = false;
+			UpdateJobClock();
+		}
+		return;
 	}
 
-	OnCraftFinished.Broadcast(ActiveJob, bSuccess);
+	FuelSource->OnFuelActiveChanged.AddUObject(this, &UCraftingStationComponent::HandleFuelActiveChanged);
+	FuelSource->SetLinkedStation(this);
 
-	bIsCrafting = false;
-	bIsPaused   = false;
-	ActiveJob   = FCraftingJob{};
+	if (HasAuth() && bIsCrafting)
+	{
+		FuelSource->OnCraftingActivated();
+		HandleFuelActiveChanged(FuelSource->IsBurnActive());
+	}
 }
 
-bool UCraftingStationComponent::MoveRequiredToInput(const UCraftingRecipeDataAsset* Recipe, int32 Times, AActor* InstigatorActor)
+void UCraftingStationComponent::HandleFuelActiveChanged(bool bActive)
 {
-	if (!HasAuth() || !Recipe || Times <= 0 || !InputInventory) return false;
+	if (!HasAuth() || bIsDormant) return;
 
-	UInventoryComponent* Source = UInventoryHelpers::GetInventoryComponent(InstigatorActor ? InstigatorActor : GetOwner());
-	if (!Source) return false;
+	const bool bStarved = bIsCrafting && !bActive;
+	if (bStarved == bIsFuelStarved) return;
+
+	bIsFuelStarved = bStarved;
+	UpdateJobClock();
+}
+
+void UCraftingStationComponent::UpdateJobClock()
+{
+	if (!HasAuth()) return;
+
+	const float Now = GetServerTimeSeconds();
+	const bool bShouldRun = !bIsPaused && !bIsFuelStarved && !bIsDormant;
+	bool bChanged = false;
+
+	for (FCraftingJob& Job : Jobs.Items)
+	{
+		if (!Job.IsStarted()) continue;
+
+		if (bShouldRun && !Job.IsRunning())
+		{
+			// Rebase: whatever was left when the job halted is owed from now.
+			Job.EndTime = Now + Job.RemainingSeconds;
+		}
+		else if (!bShouldRun && Job.IsRunning())
+		{
+			Job.RemainingSeconds = FMath::Max(0.f, Job.EndTime - Now);
+			Job.EndTime = -1.f;
+		}
+		else
+		{
+			continue;
+		}
 
-	// Inputs expected to be an array of structs with a GameplayTag + Amount/Count/Quantity int field.
-	TArray<TPair<FGameplayTag,int32>> Req = ExtractTagAmountArray(Recipe, TEXT("Inputs"));
-	if (Req.Num() == 0) return true;
+		Jobs.MarkItemDirty(Job);
+		bChanged = true;
+	}
+
+	ScheduleWakeup();
 
-	for (const auto& Pair : Req)
+	if (bChanged)
 	{
-		const FGameplayTag& Tag = Pair.Key;
-		const int32 Needed = Pair.Value * Times;
-		if (!RemoveAndStage(Source, InputInventory, Tag, Needed))
+		if (AActor* Owner = GetOwner())
 		{
-			return false;
+			Owner->ForceNetUpdate();
 		}
 	}
+}
+
+void UCraftingStationComponent::ScheduleWakeup()
+{
+	UWorld* W = GetWorld();
+	if (!W) return;
+
+	float Earliest = TNumericLimits<float>::Max();
+	for (const FCraftingJob& Job : Jobs.Items)
+	{
+		if (Job.IsRunning()) Earliest = FMath::Min(Earliest, Job.EndTime);
+	}
+
+	if (Earliest == TNumericLimits<float>::Max())
+	{
+		W->GetTimerManager().ClearTimer(CraftTimerHandle);
+		return;
+	}
+
+	// SetTimer treats <= 0 as "clear"; an already finished job completes on the next tick.
+	const float Delay = FMath::Max(0.001f, Earliest - GetServerTimeSeconds());
+	W->GetTimerManager().SetTimer(CraftTimerHandle, this, &UCraftingStationComponent::FinishDueJobs, Delay, false);
+}
+
+float UCraftingStationComponent::GetServerTimeSeconds() const
+{
+	const UWorld* W = GetWorld();
+	if (!W) return 0.f;
+	if (const AGameStateBase* GS = W->GetGameState())
+	{
+		return static_cast<float>(GS->GetServerWorldTimeSeconds());
+	}
+	return W->GetTimeSeconds();
+}
+
+bool UCraftingStationComponent::ReserveInputs(const UCraftingRecipeDataAsset* Recipe, int32 Times, AActor* InstigatorActor, FCraftingJob& Job)
+{
+	if (!HasAuth() || !Recipe || Times <= 0 || !InputInventory) return false;
+
+	const FCompiledRecipe& Compiled = Recipe->GetCompiled();
+	if (Compiled.Inputs.Num() == 0) return true;
+
+	UInventoryComponent* Source = UInventoryHelpers::GetInventoryComponent(InstigatorActor ? InstigatorActor : GetOwner());
+	if (!Source) return false;
+
+	TArray<FInventoryReservationLine> Lines;
+	Lines.Reserve(Compiled.Inputs.Num());
+	for (const FCompiledRecipeItem& Line : Compiled.Inputs)
+	{
+		Lines.Add({ Line.ItemIDTag, Line.Quantity * Times });
+	}
 
+	// All lines or none: a short line leaves nothing held.
+	const int32 ReservationId = Source->ReserveItems(Lines);
+	if (ReservationId == INDEX_NONE) return false;
+
+	Job.ReservedFrom  = Source;
+	Job.ReservationId = ReservationId;
 	return true;
 }
 
-void UCraftingStationComponent::DeliverOutputs(const UCraftingRecipeDataAsset* Recipe)
+bool UCraftingStationComponent::CommitInputs(UInventoryComponent* Source, int32 ReservationId)
 {
-	if (!HasAuth() || !Recipe || !OutputInventory) return;
+	if (ReservationId == INDEX_NONE) return true;
+	if (!Source || !Source->HasReservation(ReservationId)) return false;
+
+	// Crafting straight out of the input inventory: the items are already where they need to be.
+	if (Source == InputInventory)
+	{
+		Source->ReleaseReservation(ReservationId);
+		return true;
+	}
+
+	if (Source->CommitReservation(ReservationId, InputInventory)) return true;
+
+	Source->ReleaseReservation(ReservationId);
+	return false;
+}
+
+void UCraftingStationComponent::ReleaseInputs(const FCraftingJob& Job)
+{
+	if (UInventoryComponent* Source = Job.ReservedFrom.Get())
+	{
+		Source->ReleaseReservation(Job.ReservationId);
+	}
+}
+
+namespace CraftingOutputs
+{
+	// Streamed in and pinned since the job was queued; only a job finishing before its stream lands loads here.
+	static UItemDataAsset* Resolve(const FCompiledRecipeItem& Line)
+	{
+		if (UItemDataAsset* Resident = Line.Item.Get()) return Resident;
+		return Cast<UItemDataAsset>(InventorySyncLoad::TryLoad(Line.Item.ToSoftObjectPath(), TEXT("CraftingStation.DeliverOutputs")));
+	}
+}
 
-	// Outputs expected to be an array of structs with a GameplayTag + Amount/Count/Quantity int field.
-	TArray<TPair<FGameplayTag,int32>> Outs = ExtractTagAmountArray(Recipe, TEXT("Outputs"));
-	if (Outs.Num() == 0) return;
+void UCraftingStationComponent::DeliverOutputs(const UCraftingRecipeDataAsset* Recipe, int32 Times)
+{
+	if (!HasAuth() || !Recipe || !OutputInventory) return;
 
-	for (const auto& Pair : Outs)
+	for (const FCompiledRecipeItem& Line : Recipe->GetCompiled().Outputs)
 	{
-		const FGameplayTag& Tag = Pair.Key;
-		const int32 Amount = Pair.Value;
+		OutputInventory->TryAddItem(CraftingOutputs::Resolve(Line), Line.Quantity * FMath::Max(1, Times));
+	}
+}
 
-		if (!Tag.IsValid() || Amount <= 0) continue;
+void UCraftingStationComponent::DeliverJobOutputs(const TArray<FCraftingJob>& Finished)
+{
+	if (!HasAuth() || !OutputInventory) return;
 
-		if (UItemDataAsset* Item = UInventoryHelpers::FindItemDataByTag(this, Tag))
+	TArray<TPair<UItemDataAsset*, int32>> Stacks;
+	for (const FCraftingJob& Job : Finished)
+	{
+		if (!Job.Recipe) continue;
+		for (const FCompiledRecipeItem& Line : Job.Recipe->GetCompiled().Outputs)
 		{
-			OutputInventory->TryAddItem(Item, Amount);
+			Stacks.Emplace(CraftingOutputs::Resolve(Line), Line.Quantity * FMath::Max(1, Job.Count));
 		}
 	}
+	if (Stacks.Num() == 0) return;
+
+	if (OutputInventory->AddItems(Stacks, OutputInventory->GetOwner())) return;
+
+	// Doesn't fit as a whole: deliver line by line so whatever fits still lands.
+	for (const FCraftingJob& Job : Finished)
+	{
+		DeliverOutputs(Job.Recipe, Job.Count);
+	}
 }
 
 void UCraftingStationComponent::GiveFinishXPIIfAny(const UCraftingRecipeDataAsset* /*Recipe*/, AActor* /*InstigatorActor*/, bool /*bSuccess*/)
 {
 }
 
+// --- Registry ---
+void UCraftingStationComponent::SetStationTags(const FGameplayTagContainer& NewTags)
+{
+	StationTags = NewTags;
+	RefreshStationRegistration();
+}
+
+void UCraftingStationComponent::RefreshStationRegistration()
+{
+	if (RegistryHandle == INDEX_NONE) return;
+
+	if (UCraftingStationRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UCraftingStationRegistrySubsystem>() : nullptr)
+	{
+		Registry->UpdateStation(RegistryHandle);
+	}
+}
+
 void UCraftingStationComponent::GatherOwnedTagsFromActor(AActor* Viewer, FGameplayTagContainer& Out) const
 {
 	Out.Reset();
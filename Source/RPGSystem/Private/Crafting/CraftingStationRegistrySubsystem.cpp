@@ -0,0 +1,289 @@
+// CraftingStationRegistrySubsystem.cpp
+#include "Crafting/CraftingStationRegistrySubsystem.h"
+#include "Crafting/CraftingStationComponent.h"
+#include "Crafting/CraftingRecipeDataAsset.h"
+#include "FuelSystem/FuelComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+namespace StationRegistry
+{
+	// XY cell edge in cm; a typical "stations near me" radius (10-30 m) covers 1-9 cells.
+	constexpr float CellSize = 2000.f;
+
+	// Dormancy sweep: wake inside WakeRadius, park beyond SleepRadius; the gap keeps a player on the edge from toggling it.
+	constexpr float DormancyInterval = 2.f;
+	constexpr float WakeRadius       = 6000.f;
+	constexpr float SleepRadius      = 8000.f;
+}
+
+bool UCraftingStationRegistrySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Clients too: building UIs query nearby stations locally.
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UCraftingStationRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.GetNetMode() != NM_Client)
+	{
+		InWorld.GetTimerManager().SetTimer(DormancyTimerHandle, this, &UCraftingStationRegistrySubsystem::UpdateDormancy,
+			StationRegistry::DormancyInterval, true);
+	}
+}
+
+void UCraftingStationRegistrySubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DormancyTimerHandle);
+	}
+	Stations.Reset();
+	FreeStations.Reset();
+	Cells.Reset();
+	TagCounts.Reset();
+	Super::Deinitialize();
+}
+
+// --- Stations ---
+int32 UCraftingStationRegistrySubsystem::RegisterStation(UCraftingStationComponent* Station)
+{
+	const AActor* Owner = Station ? Station->GetOwner() : nullptr;
+	if (!Owner) return INDEX_NONE;
+
+	const int32 Handle = FreeStations.Num() > 0 ? FreeStations.Pop(EAllowShrinking::No) : Stations.AddDefaulted();
+
+	FRegisteredStation& S = Stations[Handle];
+	S = FRegisteredStation();
+	S.Station  = Station;
+	S.Location = Owner->GetActorLocation();
+	S.Tags     = Station->StationTags;
+	S.bInUse   = true;
+
+	Link(Handle, true);
+	return Handle;
+}
+
+void UCraftingStationRegistrySubsystem::UnregisterStation(int32 Handle)
+{
+	if (!Stations.IsValidIndex(Handle) || !Stations[Handle].bInUse) return;
+
+	Link(Handle, false);
+	Stations[Handle] = FRegisteredStation();
+	FreeStations.Add(Handle);
+}
+
+void UCraftingStationRegistrySubsystem::UpdateStation(int32 Handle)
+{
+	if (!Stations.IsValidIndex(Handle) || !Stations[Handle].bInUse) return;
+
+	FRegisteredStation& S = Stations[Handle];
+	const UCraftingStationComponent* Station = S.Station.Get();
+	const AActor* Owner = Station ? Station->GetOwner() : nullptr;
+	if (!Owner)
+	{
+		UnregisterStation(Handle);
+		return;
+	}
+
+	Link(Handle, false);
+	S.Location = Owner->GetActorLocation();
+	S.Tags     = Station->StationTags;
+	Link(Handle, true);
+}
+
+// --- Grid ---
+FIntPoint UCraftingStationRegistrySubsystem::CellOf(const FVector& Point)
+{
+	return FIntPoint(FMath::FloorToInt(Point.X / StationRegistry::CellSize), FMath::FloorToInt(Point.Y / StationRegistry::CellSize));
+}
+
+void UCraftingStationRegistrySubsystem::Link(int32 Handle, bool bLink)
+{
+	FRegisteredStation& S = Stations[Handle];
+
+	if (bLink)
+	{
+		S.Cell = CellOf(S.Location);
+		Cells.FindOrAdd(S.Cell).Add(Handle);
+	}
+	else if (TArray<int32>* InCell = Cells.Find(S.Cell))
+	{
+		InCell->RemoveSingleSwap(Handle, EAllowShrinking::No);
+		if (InCell->Num() == 0) Cells.Remove(S.Cell);
+	}
+
+	// Parents count too: a Station.Forge.Master satisfies a recipe asking for Station.Forge.
+	for (const FGameplayTag& Tag : S.Tags.GetGameplayTagParents())
+	{
+		if (bLink)
+		{
+			++TagCounts.FindOrAdd(Tag);
+		}
+		else if (int32* Count = TagCounts.Find(Tag))
+		{
+			if (--*Count <= 0) TagCounts.Remove(Tag);
+		}
+	}
+}
+
+bool UCraftingStationRegistrySubsystem::AnyStationOffers(const FGameplayTagContainer& RequiredTags) const
+{
+	for (const FGameplayTag& Tag : RequiredTags)
+	{
+		if (!TagCounts.Contains(Tag)) return false;
+	}
+	return true;
+}
+
+template<typename FVisitor>
+void UCraftingStationRegistrySubsystem::ForEachStationInRange(const FVector& Location, float Radius, const FGameplayTagContainer& RequiredTags, FVisitor&& Visitor) const
+{
+	if (Radius < 0.f || !AnyStationOffers(RequiredTags)) return;
+
+	const FIntPoint Min = CellOf(Location - FVector(Radius, Radius, 0.f));
+	const FIntPoint Max = CellOf(Location + FVector(Radius, Radius, 0.f));
+	const float RadiusSq = FMath::Square(Radius);
+
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			const TArray<int32>* InCell = Cells.Find(FIntPoint(X, Y));
+			if (!InCell) continue;
+
+			for (const int32 Handle : *InCell)
+			{
+				const FRegisteredStation& S = Stations[Handle];
+
+				const float DistSq = FVector::DistSquared(S.Location, Location);
+				if (DistSq > RadiusSq) continue;
+				if (!S.Tags.HasAll(RequiredTags)) continue;
+
+				if (UCraftingStationComponent* Station = S.Station.Get())
+				{
+					Visitor(Station, DistSq);
+				}
+			}
+		}
+	}
+}
+
+// --- Dormancy ---
+void UCraftingStationRegistrySubsystem::UpdateDormancy()
+{
+	const UWorld* World = GetWorld();
+	if (!World || GetNumStations() == 0) return;
+
+	// Marks come from the grid around each player, so the cost follows players, not stations.
+	TBitArray<> Near(false, Stations.Num());
+	TBitArray<> Wake(false, Stations.Num());
+	const float WakeSq  = FMath::Square(StationRegistry::WakeRadius);
+	const float SleepSq = FMath::Square(StationRegistry::SleepRadius);
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		if (!Pawn) continue;
+
+		const FVector Location = Pawn->GetActorLocation();
+		const FIntPoint Min = CellOf(Location - FVector(StationRegistry::SleepRadius, StationRegistry::SleepRadius, 0.f));
+		const FIntPoint Max = CellOf(Location + FVector(StationRegistry::SleepRadius, StationRegistry::SleepRadius, 0.f));
+
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+			{
+				const TArray<int32>* InCell = Cells.Find(FIntPoint(X, Y));
+				if (!InCell) continue;
+
+				for (const int32 Handle : *InCell)
+				{
+					const float DistSq = FVector::DistSquared(Stations[Handle].Location, Location);
+					if (DistSq <= SleepSq) Near[Handle] = true;
+					if (DistSq <= WakeSq)  Wake[Handle] = true;
+				}
+			}
+		}
+	}
+
+	for (int32 Handle = 0; Handle < Stations.Num(); ++Handle)
+	{
+		FRegisteredStation& S = Stations[Handle];
+		UCraftingStationComponent* Station = S.bInUse ? S.Station.Get() : nullptr;
+		if (!Station || !Station->bAutoDormancy) continue;
+
+		// A fire that must burn regardless of crafting would be banked by parking; leave it awake.
+		if (Station->FuelSource && !Station->FuelSource->bAutoStopBurnWhenIdle) continue;
+
+		if (!Station->IsDormant())
+		{
+			// Woken by someone else (or never parked): ours to park again.
+			S.bAutoDormant = false;
+			if (!Near[Handle])
+			{
+				Station->SetDormant(true);
+				S.bAutoDormant = true;
+			}
+		}
+		else if (S.bAutoDormant && Wake[Handle])
+		{
+			S.bAutoDormant = false;
+			Station->SetDormant(false);
+		}
+	}
+}
+
+// --- Queries ---
+void UCraftingStationRegistrySubsystem::FindStations(const FVector& Location, float Radius, const FGameplayTagContainer& RequiredTags,
+	TArray<UCraftingStationComponent*>& OutStations) const
+{
+	OutStations.Reset();
+
+	TArray<TPair<float, UCraftingStationComponent*>, TInlineAllocator<16>> Found;
+	ForEachStationInRange(Location, Radius, RequiredTags, [&Found](UCraftingStationComponent* Station, float DistSq)
+	{
+		Found.Emplace(DistSq, Station);
+	});
+
+	Found.Sort([](const TPair<float, UCraftingStationComponent*>& A, const TPair<float, UCraftingStationComponent*>& B) { return A.Key < B.Key; });
+
+	OutStations.Reserve(Found.Num());
+	for (const TPair<float, UCraftingStationComponent*>& It : Found)
+	{
+		OutStations.Add(It.Value);
+	}
+}
+
+UCraftingStationComponent* UCraftingStationRegistrySubsystem::FindNearestStation(const FVector& Location, float Radius, const FGameplayTagContainer& RequiredTags) const
+{
+	UCraftingStationComponent* Best = nullptr;
+	float BestDistSq = TNumericLimits<float>::Max();
+
+	ForEachStationInRange(Location, Radius, RequiredTags, [&Best, &BestDistSq](UCraftingStationComponent* Station, float DistSq)
+	{
+		if (DistSq < BestDistSq)
+		{
+			Best       = Station;
+			BestDistSq = DistSq;
+		}
+	});
+	return Best;
+}
+
+void UCraftingStationRegistrySubsystem::FindStationsForRecipe(const FVector& Location, float Radius, const UCraftingRecipeDataAsset* Recipe,
+	TArray<UCraftingStationComponent*>& OutStations) const
+{
+	if (!Recipe)
+	{
+		OutStations.Reset();
+		return;
+	}
+	FindStations(Location, Radius, Recipe->RequiredStationTags, OutStations);
+}
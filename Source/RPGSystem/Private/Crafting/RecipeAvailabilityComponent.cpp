@@ -0,0 +1,320 @@
+// RecipeAvailabilityComponent.cpp
+#include "Crafting/RecipeAvailabilityComponent.h"
+#include "Crafting/CraftingRecipeDataAsset.h"
+#include "Inventory/InventoryComponent.h"
+#include "Inventory/InventoryHelpers.h"
+
+URecipeAvailabilityComponent::URecipeAvailabilityComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void URecipeAvailabilityComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	RebuildIndex();
+
+	if (bTrackOwnerInventory)
+	{
+		AddSourceInventory(UInventoryHelpers::GetInventoryComponent(GetOwner()));
+	}
+}
+
+void URecipeAvailabilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (const FSourceState& Source : Sources)
+	{
+		BindSource(Source.Inventory.Get(), false);
+	}
+	Sources.Reset();
+	Super::EndPlay(EndPlayReason);
+}
+
+// --- Setup ---
+void URecipeAvailabilityComponent::SetRecipes(const TArray<UCraftingRecipeDataAsset*>& NewRecipes)
+{
+	Recipes.Reset(NewRecipes.Num());
+	for (UCraftingRecipeDataAsset* Recipe : NewRecipes)
+	{
+		if (Recipe) Recipes.Add(Recipe);
+	}
+	RebuildIndex();
+}
+
+void URecipeAvailabilityComponent::AddSourceInventory(UInventoryComponent* Inventory)
+{
+	if (!Inventory) return;
+	if (Sources.ContainsByPredicate([Inventory](const FSourceState& S) { return S.Inventory == Inventory; })) return;
+
+	FSourceState& Source = Sources.AddDefaulted_GetRef();
+	Source.Inventory = Inventory;
+	BindSource(Inventory, true);
+
+	TArray<FGameplayTag> Dirty;
+	ResyncSource(Source, Dirty);
+	RecomputeRecipes(Dirty);
+}
+
+void URecipeAvailabilityComponent::RemoveSourceInventory(UInventoryComponent* Inventory)
+{
+	const int32 Idx = Sources.IndexOfByPredicate([Inventory](const FSourceState& S) { return S.Inventory == Inventory; });
+	if (Idx == INDEX_NONE) return;
+
+	BindSource(Inventory, false);
+
+	// Its tags are re-counted without it.
+	TArray<FGameplayTag> Dirty;
+	for (const TPair<FGameplayTag, int32>& Slot : Sources[Idx].Slots)
+	{
+		if (Slot.Key.IsValid()) Dirty.AddUnique(Slot.Key);
+	}
+	Sources.RemoveAtSwap(Idx);
+	RecomputeRecipes(Dirty);
+}
+
+void URecipeAvailabilityComponent::BindSource(UInventoryComponent* Inventory, bool bBind)
+{
+	if (!Inventory) return;
+
+	if (bBind)
+	{
+		Inventory->OnInventoryDelta.AddUObject(this, &URecipeAvailabilityComponent::HandleInventoryDelta);
+		Inventory->OnReservationsChanged.AddUObject(this, &URecipeAvailabilityComponent::HandleReservationsChanged);
+	}
+	else
+	{
+		Inventory->OnInventoryDelta.RemoveAll(this);
+		Inventory->OnReservationsChanged.RemoveAll(this);
+	}
+}
+
+void URecipeAvailabilityComponent::RebuildIndex()
+{
+	Needs.Reset();
+	MaxCounts.Reset();
+	RecipesByInput.Reset();
+	RecipeIndex.Reset();
+	TotalByTag.Reset();
+
+	for (int32 i = 0; i < Recipes.Num(); ++i)
+	{
+		const UCraftingRecipeDataAsset* Recipe = Recipes[i];
+		RecipeIndex.Add(Recipe, i);
+
+		FRecipeNeeds& RecipeNeeds = Needs.AddDefaulted_GetRef();
+		MaxCounts.Add(0);
+		if (!Recipe) continue;
+
+		for (const FCompiledRecipeItem& Line : Recipe->GetCompiled().Inputs)
+		{
+			TPair<FGameplayTag, int32>* Existing = RecipeNeeds.PerTag.FindByPredicate(
+				[&Line](const TPair<FGameplayTag, int32>& P) { return P.Key == Line.ItemIDTag; });
+
+			if (Existing) Existing->Value += Line.Quantity;
+			else          RecipeNeeds.PerTag.Emplace(Line.ItemIDTag, Line.Quantity);
+
+			RecipesByInput.FindOrAdd(Line.ItemIDTag).AddUnique(i);
+		}
+	}
+
+	// Slot caches only hold tags the index cares about, so they are rebuilt with it.
+	TArray<FGameplayTag> Dirty;
+	for (FSourceState& Source : Sources)
+	{
+		Source.Slots.Reset();
+		ResyncSource(Source, Dirty);
+	}
+	RefreshTotals(Dirty);
+
+	for (int32 i = 0; i < Recipes.Num(); ++i)
+	{
+		MaxCounts[i] = ComputeMaxCount(i);
+		OnRecipeAvailabilityChanged.Broadcast(Recipes[i], MaxCounts[i]);
+	}
+}
+
+// --- Deltas ---
+void URecipeAvailabilityComponent::HandleInventoryDelta(UInventoryComponent* Inventory, const FInventoryDelta& Delta)
+{
+	FSourceState* Source = Sources.FindByPredicate([Inventory](const FSourceState& S) { return S.Inventory == Inventory; });
+	if (!Source || !Inventory) return;
+
+	TArray<FGameplayTag> Dirty;
+
+	if (Delta.bFullRefresh || Source->Slots.Num() != Inventory->GetItems().Num())
+	{
+		ResyncSource(*Source, Dirty);
+	}
+	else
+	{
+		// Moves only relocate stacks: permute the cache, totals stay as they are.
+		if (Delta.Moves.Num() > 0)
+		{
+			const TArray<TPair<FGameplayTag, int32>> Before = Source->Slots;
+			for (const TPair<int32, int32>& Move : Delta.Moves)
+			{
+				if (Before.IsValidIndex(Move.Key) && Source->Slots.IsValidIndex(Move.Value))
+				{
+					Source->Slots[Move.Value] = Before[Move.Key];
+				}
+			}
+		}
+
+		for (const int32 SlotIndex : Delta.ChangedSlots)
+		{
+			ApplySlot(*Source, SlotIndex, Dirty);
+		}
+	}
+
+	RecomputeRecipes(Dirty);
+}
+
+void URecipeAvailabilityComponent::HandleReservationsChanged(UInventoryComponent* Inventory, TConstArrayView<FGameplayTag> ItemIDTags)
+{
+	if (!Sources.ContainsByPredicate([Inventory](const FSourceState& S) { return S.Inventory == Inventory; })) return;
+
+	TArray<FGameplayTag> Dirty;
+	for (const FGameplayTag& Tag : ItemIDTags)
+	{
+		if (RecipesByInput.Contains(Tag)) Dirty.AddUnique(Tag);
+	}
+	RecomputeRecipes(Dirty);
+}
+
+TPair<FGameplayTag, int32> URecipeAvailabilityComponent::ReadSlot(const UInventoryComponent* Inventory, int32 SlotIndex) const
+{
+	const TArray<FInventoryItem>& Items = Inventory->GetItems();
+	if (!Items.IsValidIndex(SlotIndex) || !Items[SlotIndex].IsValid()) return TPair<FGameplayTag, int32>(FGameplayTag(), 0);
+
+	// The tag comes from the index when the definition isn't resident, so this never loads.
+	const FInventoryItem& Item = Items[SlotIndex];
+	const FGameplayTag ItemID = Item.GetItemIDTag();
+	if (!RecipesByInput.Contains(ItemID)) return TPair<FGameplayTag, int32>(FGameplayTag(), 0);
+
+	return TPair<FGameplayTag, int32>(ItemID, Item.Quantity);
+}
+
+void URecipeAvailabilityComponent::ApplySlot(FSourceState& Source, int32 SlotIndex, TArray<FGameplayTag>& OutDirtyTags)
+{
+	const UInventoryComponent* Inventory = Source.Inventory.Get();
+	if (!Inventory || !Source.Slots.IsValidIndex(SlotIndex)) return;
+
+	const TPair<FGameplayTag, int32> Now = ReadSlot(Inventory, SlotIndex);
+	TPair<FGameplayTag, int32>& Was = Source.Slots[SlotIndex];
+	if (Now.Key == Was.Key && Now.Value == Was.Value) return;
+
+	if (Was.Key.IsValid()) OutDirtyTags.AddUnique(Was.Key);
+	if (Now.Key.IsValid()) OutDirtyTags.AddUnique(Now.Key);
+	Was = Now;
+}
+
+void URecipeAvailabilityComponent::ResyncSource(FSourceState& Source, TArray<FGameplayTag>& OutDirtyTags)
+{
+	const UInventoryComponent* Inventory = Source.Inventory.Get();
+	const int32 NumSlots = Inventory ? Inventory->GetItems().Num() : 0;
+
+	// Shrinking: slots that no longer exist dirty what they held.
+	for (int32 i = NumSlots; i < Source.Slots.Num(); ++i)
+	{
+		const TPair<FGameplayTag, int32>& Was = Source.Slots[i];
+		if (Was.Key.IsValid()) OutDirtyTags.AddUnique(Was.Key);
+	}
+	Source.Slots.SetNum(NumSlots);
+
+	for (int32 i = 0; i < NumSlots; ++i)
+	{
+		ApplySlot(Source, i, OutDirtyTags);
+	}
+}
+
+// --- Counts ---
+void URecipeAvailabilityComponent::RefreshTotals(const TArray<FGameplayTag>& DirtyTags)
+{
+	// Re-counted rather than diffed, since reservations move availability without touching any slot; but from the
+	// cached slot counts, one pass per source for all dirty tags, so the inventories themselves are never rescanned.
+	TMap<FGameplayTag, int32> Totals;
+	TMap<FGameplayTag, int32> Held;
+	Totals.Reserve(DirtyTags.Num());
+	Held.Reserve(DirtyTags.Num());
+	for (const FGameplayTag& Tag : DirtyTags)
+	{
+		Totals.Add(Tag, 0);
+		Held.Add(Tag, 0);
+	}
+
+	for (const FSourceState& Source : Sources)
+	{
+		const UInventoryComponent* Inventory = Source.Inventory.Get();
+		if (!Inventory) continue;
+
+		for (TPair<FGameplayTag, int32>& It : Held) It.Value = 0;
+		for (const TPair<FGameplayTag, int32>& Slot : Source.Slots)
+		{
+			if (int32* Count = Held.Find(Slot.Key)) *Count += Slot.Value;
+		}
+
+		// Per inventory, as GetAvailableQuantity clamps it.
+		for (const TPair<FGameplayTag, int32>& It : Held)
+		{
+			Totals[It.Key] += FMath::Max(0, It.Value - Inventory->GetReservedQuantity(It.Key));
+		}
+	}
+
+	for (const TPair<FGameplayTag, int32>& It : Totals)
+	{
+		if (It.Value > 0) TotalByTag.Add(It.Key, It.Value);
+		else              TotalByTag.Remove(It.Key);
+	}
+}
+
+void URecipeAvailabilityComponent::RecomputeRecipes(const TArray<FGameplayTag>& DirtyTags)
+{
+	RefreshTotals(DirtyTags);
+
+	TArray<int32, TInlineAllocator<32>> Touched;
+	for (const FGameplayTag& Tag : DirtyTags)
+	{
+		if (const TArray<int32>* Users = RecipesByInput.Find(Tag))
+		{
+			for (const int32 Idx : *Users) Touched.AddUnique(Idx);
+		}
+	}
+
+	for (const int32 Idx : Touched)
+	{
+		const int32 Count = ComputeMaxCount(Idx);
+		if (Count == MaxCounts[Idx]) continue;
+
+		MaxCounts[Idx] = Count;
+		OnRecipeAvailabilityChanged.Broadcast(Recipes[Idx], Count);
+	}
+}
+
+int32 URecipeAvailabilityComponent::ComputeMaxCount(int32 RecipeIdx) const
+{
+	if (!Recipes.IsValidIndex(RecipeIdx) || !Recipes[RecipeIdx]) return 0;
+
+	int32 Count = MaxReportedCount;
+	for (const TPair<FGameplayTag, int32>& Need : Needs[RecipeIdx].PerTag)
+	{
+		Count = FMath::Min(Count, FMath::Max(0, TotalByTag.FindRef(Need.Key)) / FMath::Max(1, Need.Value));
+		if (Count == 0) break;
+	}
+	return Count;
+}
+
+int32 URecipeAvailabilityComponent::GetMaxCraftCount(const UCraftingRecipeDataAsset* Recipe) const
+{
+	const int32* Idx = RecipeIndex.Find(Recipe);
+	return Idx ? MaxCounts[*Idx] : 0;
+}
+
+void URecipeAvailabilityComponent::GetCraftableRecipes(TArray<UCraftingRecipeDataAsset*>& OutRecipes) const
+{
+	OutRecipes.Reset();
+	for (int32 i = 0; i < Recipes.Num(); ++i)
+	{
+		if (MaxCounts[i] > 0) OutRecipes.Add(Recipes[i]);
+	}
+}
@@ -0,0 +1,318 @@
+// RecipeCatalogSubsystem.cpp
+#include "Crafting/RecipeCatalogSubsystem.h"
+#include "Crafting/CraftingRecipeDataAsset.h"
+#include "Inventory/WorkstationDataAsset.h"
+#include "Inventory/SyncLoadStats.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
+#include "Modules/ModuleManager.h"
+
+URecipeCatalogSubsystem* URecipeCatalogSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<URecipeCatalogSubsystem>() : nullptr;
+}
+
+void URecipeCatalogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Whichever of us and the asset manager comes up second starts the preload.
+	if (UAssetManager::IsInitialized())
+	{
+		Preload();
+	}
+}
+
+void URecipeCatalogSubsystem::Deinitialize()
+{
+	if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+	{
+		FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().OnFilesLoaded().RemoveAll(this);
+	}
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->CancelHandle();
+		LoadHandle.Reset();
+	}
+	RecipePaths.Reset();
+	ResetIndex();
+	Super::Deinitialize();
+}
+
+void URecipeCatalogSubsystem::Invalidate()
+{
+	// The old handle's callback would rebuild from the old path list.
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->CancelHandle();
+		LoadHandle.Reset();
+	}
+	RecipePaths.Reset();
+	ResetIndex();
+
+	Preload();
+}
+
+void URecipeCatalogSubsystem::ResetIndex()
+{
+	Recipes.Reset();
+	ById.Reset();
+	ByPath.Reset();
+	ByDiscipline.Reset();
+	ByStationTag.Reset();
+	ByUnlockTag.Reset();
+	ByOutput.Reset();
+	WorkstationCache.Reset();
+	bBuilt = false;
+}
+
+void URecipeCatalogSubsystem::InvalidateWorkstation(const UWorkstationDataAsset* Workstation)
+{
+	WorkstationCache.Remove(TObjectKey<UWorkstationDataAsset>(Workstation));
+}
+
+// --- Build ---
+void URecipeCatalogSubsystem::Preload()
+{
+	if (bBuilt || LoadHandle.IsValid()) return;
+
+	// Editor startup: the registry is still scanning; build once it has seen every recipe.
+	IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (AR.IsLoadingAssets())
+	{
+		AR.OnFilesLoaded().RemoveAll(this);
+		AR.OnFilesLoaded().AddUObject(this, &URecipeCatalogSubsystem::HandleFilesLoaded);
+		return;
+	}
+
+	RequestLoad();
+}
+
+void URecipeCatalogSubsystem::HandleFilesLoaded()
+{
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().OnFilesLoaded().RemoveAll(this);
+	Preload();
+}
+
+void URecipeCatalogSubsystem::RequestLoad()
+{
+	IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FAssetData> Assets;
+	AR.GetAssetsByClass(UCraftingRecipeDataAsset::StaticClass()->GetClassPathName(), Assets, true);
+
+	RecipePaths.Reset(Assets.Num());
+	for (const FAssetData& AD : Assets)
+	{
+		RecipePaths.Add(AD.ToSoftObjectPath());
+	}
+
+	// UInventoryAssetManager::StartInitialLoading calls Preload again once streaming is available.
+	if (!UAssetManager::IsInitialized()) return;
+	if (RecipePaths.Num() == 0)
+	{
+		BuildIndex();
+		return;
+	}
+
+	// One batched request for every recipe instead of a load per lookup.
+	LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		RecipePaths, FStreamableDelegate::CreateUObject(this, &URecipeCatalogSubsystem::BuildIndex));
+}
+
+bool URecipeCatalogSubsystem::EnsureBuilt()
+{
+	// Never waits: an early query just makes sure the build is on its way.
+	if (!bBuilt) Preload();
+	return bBuilt;
+}
+
+void URecipeCatalogSubsystem::BuildIndex()
+{
+	const double Start = FPlatformTime::Seconds();
+
+	ResetIndex();
+
+	for (const FSoftObjectPath& Path : RecipePaths)
+	{
+		UObject* Obj = Path.ResolveObject();
+		if (!Obj && !LoadHandle.IsValid())
+		{
+			Obj = InventorySyncLoad::TryLoad(Path, TEXT("RecipeCatalog.BuildIndex"));
+		}
+
+		UCraftingRecipeDataAsset* Recipe = Cast<UCraftingRecipeDataAsset>(Obj);
+		if (!Recipe) continue;
+
+		const int32 Idx = Recipes.Add(Recipe);
+		ByPath.Add(Path, Idx);
+
+		if (Recipe->RecipeIDTag.IsValid())
+		{
+			if (const int32* Existing = ById.Find(Recipe->RecipeIDTag))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[Crafting] Recipe id %s used by %s and %s; keeping the first."),
+					*Recipe->RecipeIDTag.ToString(), *GetNameSafe(Recipes[*Existing]), *Recipe->GetName());
+			}
+			else
+			{
+				ById.Add(Recipe->RecipeIDTag, Idx);
+			}
+		}
+
+		if (Recipe->Discipline.IsValid()) ByDiscipline.FindOrAdd(Recipe->Discipline).Add(Idx);
+		if (Recipe->UnlockTag.IsValid())  ByUnlockTag.FindOrAdd(Recipe->UnlockTag).Add(Idx);
+
+		for (const FGameplayTag& StationTag : Recipe->RequiredStationTags)
+		{
+			ByStationTag.FindOrAdd(StationTag).Add(Idx);
+		}
+
+		// Authored outputs, not compiled ones: indexing must not depend on item data being loaded.
+		for (const FCraftItemOutput& Out : Recipe->Outputs)
+		{
+			if (Out.ItemIDTag.IsValid()) ByOutput.FindOrAdd(Out.ItemIDTag).AddUnique(Idx);
+		}
+	}
+
+	bBuilt = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[Crafting] Recipe catalog: %d recipes indexed in %.2f ms"),
+		Recipes.Num(), (FPlatformTime::Seconds() - Start) * 1000.0);
+
+	OnCatalogBuilt.Broadcast();
+}
+
+// --- Lookups ---
+void URecipeCatalogSubsystem::Collect(const TArray<int32>* Indices, TArray<UCraftingRecipeDataAsset*>& OutRecipes) const
+{
+	OutRecipes.Reset();
+	if (!Indices) return;
+
+	OutRecipes.Reserve(Indices->Num());
+	for (const int32 Idx : *Indices)
+	{
+		OutRecipes.Add(Recipes[Idx]);
+	}
+}
+
+UCraftingRecipeDataAsset* URecipeCatalogSubsystem::FindRecipe(FGameplayTag RecipeIDTag)
+{
+	EnsureBuilt();
+	const int32* Idx = ById.Find(RecipeIDTag);
+	return Idx ? Recipes[*Idx].Get() : nullptr;
+}
+
+void URecipeCatalogSubsystem::GetRecipesByDiscipline(FGameplayTag Discipline, TArray<UCraftingRecipeDataAsset*>& OutRecipes)
+{
+	EnsureBuilt();
+	Collect(ByDiscipline.Find(Discipline), OutRecipes);
+}
+
+void URecipeCatalogSubsystem::GetRecipesForStationTag(FGameplayTag StationTag, TArray<UCraftingRecipeDataAsset*>& OutRecipes)
+{
+	EnsureBuilt();
+	Collect(ByStationTag.Find(StationTag), OutRecipes);
+}
+
+void URecipeCatalogSubsystem::GetRecipesByUnlockTag(FGameplayTag UnlockTag, TArray<UCraftingRecipeDataAsset*>& OutRecipes)
+{
+	EnsureBuilt();
+	Collect(ByUnlockTag.Find(UnlockTag), OutRecipes);
+}
+
+void URecipeCatalogSubsystem::GetRecipesProducing(FGameplayTag ItemIDTag, TArray<UCraftingRecipeDataAsset*>& OutRecipes)
+{
+	EnsureBuilt();
+	Collect(ByOutput.Find(ItemIDTag), OutRecipes);
+}
+
+void URecipeCatalogSubsystem::GetAllRecipes(TArray<UCraftingRecipeDataAsset*>& OutRecipes)
+{
+	EnsureBuilt();
+	OutRecipes.Reset(Recipes.Num());
+	for (UCraftingRecipeDataAsset* Recipe : Recipes)
+	{
+		OutRecipes.Add(Recipe);
+	}
+}
+
+// --- Workstations ---
+const URecipeCatalogSubsystem::FWorkstationRecipes& URecipeCatalogSubsystem::ResolveWorkstation(const UWorkstationDataAsset* Workstation)
+{
+	// Callers check EnsureBuilt first; resolving against a half-built catalog would cache a wrong list.
+	check(bBuilt);
+
+	const TObjectKey<UWorkstationDataAsset> Key(Workstation);
+	if (const FWorkstationRecipes* Cached = WorkstationCache.Find(Key))
+	{
+		return *Cached;
+	}
+
+	FWorkstationRecipes& Entry = WorkstationCache.Add(Key);
+	Entry.bAllowAll = Workstation->AllowedRecipes.Num() == 0;
+
+	if (Entry.bAllowAll)
+	{
+		Entry.List.Reserve(Recipes.Num());
+		for (UCraftingRecipeDataAsset* Recipe : Recipes) Entry.List.Add(Recipe);
+		return Entry;
+	}
+
+	// Resolved by path against the catalog, so nothing is loaded here.
+	for (const TSoftObjectPtr<UCraftingRecipeDataAsset>& Soft : Workstation->AllowedRecipes)
+	{
+		const int32* Idx = ByPath.Find(Soft.ToSoftObjectPath());
+		if (!Idx)
+		{
+			if (!Soft.IsNull())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[Crafting] %s allows %s, which is not in the recipe catalog."),
+					*Workstation->GetName(), *Soft.ToString());
+			}
+			continue;
+		}
+
+		UCraftingRecipeDataAsset* Recipe = Recipes[*Idx];
+		bool bAlreadyIn = false;
+		Entry.Allowed.Add(Recipe, &bAlreadyIn);
+		if (!bAlreadyIn) Entry.List.Add(Recipe);
+	}
+	return Entry;
+}
+
+bool URecipeCatalogSubsystem::IsRecipeAllowed(const UWorkstationDataAsset* Workstation, const UCraftingRecipeDataAsset* Recipe)
+{
+	if (!Workstation || !Recipe) return false;
+
+	// Not built yet: same answer by path, without loading anything.
+	if (!EnsureBuilt())
+	{
+		return Workstation->AllowedRecipes.Num() == 0
+			|| Workstation->AllowedRecipes.Contains(TSoftObjectPtr<UCraftingRecipeDataAsset>(const_cast<UCraftingRecipeDataAsset*>(Recipe)));
+	}
+
+	const FWorkstationRecipes& Entry = ResolveWorkstation(Workstation);
+	if (Entry.bAllowAll || Entry.Allowed.Contains(Recipe)) return true;
+
+	// Recipes outside the catalog (transient, or created after the build) fall back to a path compare.
+	if (!ByPath.Contains(FSoftObjectPath(Recipe)))
+	{
+		return Workstation->AllowedRecipes.Contains(TSoftObjectPtr<UCraftingRecipeDataAsset>(const_cast<UCraftingRecipeDataAsset*>(Recipe)));
+	}
+	return false;
+}
+
+void URecipeCatalogSubsystem::GetRecipesForWorkstation(const UWorkstationDataAsset* Workstation, TArray<UCraftingRecipeDataAsset*>& OutRecipes)
+{
+	OutRecipes = GetWorkstationRecipes(Workstation);
+}
+
+const TArray<UCraftingRecipeDataAsset*>& URecipeCatalogSubsystem::GetWorkstationRecipes(const UWorkstationDataAsset* Workstation)
+{
+	static const TArray<UCraftingRecipeDataAsset*> None;
+	return Workstation && EnsureBuilt() ? ResolveWorkstation(Workstation).List : None;
+}
@@ -1,10 +1,15 @@
 #include "DecaySystem/DecayComponent.h"
+#include "DecaySystem/DecayProfileDataAsset.h"
+#include "DecaySystem/DecaySubsystem.h"
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/InventoryHelpers.h"
 #include "Inventory/ItemDataAsset.h"
 #include "Inventory/InventoryItem.h"
+#include "Inventory/SyncLoadStats.h"
 #include "Net/UnrealNetwork.h"
-#include "TimerManager.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
 
 UDecayComponent::UDecayComponent()
 {
@@ -18,11 +23,16 @@ void UDecayComponent::BeginPlay()
 
 	if (HasAuthoritySafe())
 	{
+		if (UDecaySubsystem* Sub = GetDecaySubsystem())
+		{
+			StoreOwnerHandle = Sub->RegisterOwner(this);
+		}
+
 		ResolveInventory();
 		ApplySettingsFromInventoryType();
 		BindInventoryChanged(true);
 		RefreshDecaySlots();
-		TryStartStopFromCurrentState();
+		PublishFromStore();
 	}
 }
 
@@ -31,7 +41,13 @@ void UDecayComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	if (HasAuthoritySafe())
 	{
 		BindInventoryChanged(false);
-		StopTimer();
+		ReleaseStoreEntries();
+
+		if (UDecaySubsystem* Sub = GetDecaySubsystem())
+		{
+			Sub->UnregisterOwner(StoreOwnerHandle);
+		}
+		StoreOwnerHandle = INDEX_NONE;
 	}
 	Super::EndPlay(EndPlayReason);
 }
@@ -47,7 +63,6 @@ void UDecayComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(UDecayComponent, bDecayActive);
-	DOREPLIFETIME(UDecayComponent, DecayCheckInterval);
 	DOREPLIFETIME(UDecayComponent, DecaySpeedMultiplier);
 	DOREPLIFETIME(UDecayComponent, EfficiencyRating);
 	DOREPLIFETIME(UDecayComponent, InputBatchSize);
@@ -61,7 +76,7 @@ void UDecayComponent::StartDecay()
 	if (HasAuthoritySafe())
 	{
 		bDecayActive = true;
-		TryStartStopFromCurrentState();
+		RebaseSlots(false);
 		return;
 	}
 	Server_StartDecay();
@@ -72,7 +87,7 @@ void UDecayComponent::StopDecay()
 	if (HasAuthoritySafe())
 	{
 		bDecayActive = false;
-		TryStartStopFromCurrentState();
+		RebaseSlots(false);
 		return;
 	}
 	Server_StopDecay();
@@ -86,7 +101,15 @@ void UDecayComponent::ForceRefresh()
 	ApplySettingsFromInventoryType();
 	const int32 Tracked = RefreshDecaySlots();
 	if (bLogDecayDebug) UE_LOG(LogTemp, Log, TEXT("[Decay] ForceRefresh -> %d tracked"), Tracked);
-	TryStartStopFromCurrentState();
+	PublishFromStore();
+}
+
+void UDecayComponent::SetDecaySpeedMultiplier(float NewMultiplier)
+{
+	if (!HasAuthoritySafe() || FMath::IsNearlyEqual(DecaySpeedMultiplier, NewMultiplier)) return;
+
+	DecaySpeedMultiplier = NewMultiplier;
+	RebaseSlots(false);
 }
 
 void UDecayComponent::RebindToInventory(UInventoryComponent* InInventory)
@@ -99,7 +122,7 @@ void UDecayComponent::RebindToInventory(UInventoryComponent* InInventory)
 
 	ApplySettingsFromInventoryType();
 	RefreshDecaySlots();
-	TryStartStopFromCurrentState();
+	PublishFromStore();
 }
 
 void UDecayComponent::SetInventoryByActor(AActor* InActor)
@@ -117,7 +140,7 @@ void UDecayComponent::SetInventoryByActor(AActor* InActor)
 
 	ApplySettingsFromInventoryType();
 	RefreshDecaySlots();
-	TryStartStopFromCurrentState();
+	PublishFromStore();
 }
 
 bool UDecayComponent::GetSlotProgress(int32 SlotIndex, float& OutRemaining, float& OutTotal) const
@@ -126,7 +149,10 @@ bool UDecayComponent::GetSlotProgress(int32 SlotIndex, float& OutRemaining, floa
 	{
 		if (S.SlotIndex == SlotIndex)
 		{
-			OutRemaining = S.DecayTimeRemaining;
+			// DecaySlots only changes on events; a running batch counts down from its expiry at RateMultiplier.
+			OutRemaining = S.ExpireServerTime >= 0.f
+				? FMath::Clamp((S.ExpireServerTime - GetServerTimeSeconds()) * S.RateMultiplier, 0.f, S.TotalDecayTime)
+				: S.DecayTimeRemaining;
 			OutTotal     = S.TotalDecayTime;
 			return true;
 		}
@@ -146,6 +172,7 @@ bool UDecayComponent::IsIdle() const
 	{
 		if (S.SlotIndex < 0) continue;
 		if (S.DecayTimeRemaining <= 0.f) continue;
+		if (S.EnvironmentMultiplier <= 0.f) continue;
 
 		const FInventoryItem Curr = Inventory->GetItem(S.SlotIndex);
 		if (Curr.Quantity >= S.BatchSize)
@@ -158,12 +185,7 @@ bool UDecayComponent::IsIdle() const
 
 void UDecayComponent::StopIfIdle()
 {
-	if (bAutoStopWhenIdle && IsIdle())
-	{
-		StopTimer();
-		bIsTrackingAny = false;
-		OnTrackingStateChanged.Broadcast(false);
-	}
+	UpdateTrackingState();
 }
 
 // --- Core ---
@@ -188,11 +210,11 @@ void UDecayComponent::BindInventoryChanged(bool bBind)
 
 	if (bBind)
 	{
-		Inventory->OnInventoryChanged.AddDynamic(this, &UDecayComponent::OnInventoryChangedRefresh);
+		Inventory->OnInventoryDelta.AddUObject(this, &UDecayComponent::HandleInventoryDelta);
 	}
 	else
 	{
-		Inventory->OnInventoryChanged.RemoveDynamic(this, &UDecayComponent::OnInventoryChangedRefresh);
+		Inventory->OnInventoryDelta.RemoveAll(this);
 	}
 }
 
@@ -200,21 +222,178 @@ void UDecayComponent::ApplySettingsFromInventoryType()
 {
 	if (!Inventory) return;
 
-	const FGameplayTag T_PlayerBackpack = FGameplayTag::RequestGameplayTag(FName("Inventory.Type.PlayerBackpack"), false);
-	const FGameplayTag T_StorageChest   = FGameplayTag::RequestGameplayTag(FName("Inventory.Type.StorageChest"),  false);
-	const FGameplayTag T_CoolStorage    = FGameplayTag::RequestGameplayTag(FName("Inventory.Type.CoolStorage"),   false);
-	const FGameplayTag T_ColdStorage    = FGameplayTag::RequestGameplayTag(FName("Inventory.Type.ColdStorage"),   false);
-	const FGameplayTag T_StoreHouse     = FGameplayTag::RequestGameplayTag(FName("Inventory.Type.StoreHouse"),    false);
-	const FGameplayTag T_Compost        = FGameplayTag::RequestGameplayTag(FName("Inventory.Type.Compost"),       false);
+	// Cached table lookup; unknown types keep whatever is set on the component.
+	if (const FDecayStorageProfile* Profile = UDecayProfileDataAsset::ResolveStorageProfile(ProfileTable, Inventory->InventoryTypeTag))
+	{
+		const bool bSpeedChanged = !FMath::IsNearlyEqual(DecaySpeedMultiplier, Profile->DecaySpeedMultiplier);
+		DecaySpeedMultiplier = Profile->DecaySpeedMultiplier;
+		EfficiencyRating     = Profile->EfficiencyRating;
+
+		if (bSpeedChanged)
+		{
+			RebaseSlots(false);
+		}
+	}
+}
+
+// --- Environment ---
+void UDecayComponent::PushEnvironment(UObject* Source, const FGameplayTagContainer& EnvironmentTags)
+{
+	if (!HasAuthoritySafe() || !Source) return;
+
+	FGameplayTagContainer& Existing = ActiveEnvironments.FindOrAdd(Source);
+	if (Existing == EnvironmentTags) return;
+	Existing = EnvironmentTags;
+
+	RebaseSlots(true);
+}
+
+void UDecayComponent::PopEnvironment(UObject* Source)
+{
+	if (!HasAuthoritySafe() || !Source) return;
+
+	if (ActiveEnvironments.Remove(Source) > 0)
+	{
+		RebaseSlots(true);
+	}
+}
+
+template<typename TFunc>
+static void ForEachDecayComponentOn(AActor* Target, TFunc&& Func)
+{
+	if (!Target) return;
+
+	TInlineComponentArray<UDecayComponent*> Found(Target);
+	if (const APawn* Pawn = Cast<APawn>(Target))
+	{
+		if (APlayerState* PS = Pawn->GetPlayerState())
+		{
+			TInlineComponentArray<UDecayComponent*> OnPS(PS);
+			Found.Append(OnPS);
+		}
+	}
+
+	for (UDecayComponent* Decay : Found)
+	{
+		if (Decay) Func(*Decay);
+	}
+}
+
+void UDecayComponent::NotifyEnvironmentEntered(AActor* Target, UObject* Source, const FGameplayTagContainer& EnvironmentTags)
+{
+	ForEachDecayComponentOn(Target, [Source, &EnvironmentTags](UDecayComponent& Decay)
+	{
+		Decay.PushEnvironment(Source, EnvironmentTags);
+	});
+}
+
+void UDecayComponent::NotifyEnvironmentExited(AActor* Target, UObject* Source)
+{
+	ForEachDecayComponentOn(Target, [Source](UDecayComponent& Decay)
+	{
+		Decay.PopEnvironment(Source);
+	});
+}
+
+float UDecayComponent::ComputeEnvironmentMultiplier(const FGameplayTagContainer& ItemTags) const
+{
+	float Mult = 1.f;
+	for (const FGameplayTag& EnvTag : ActiveEnvironmentTags)
+	{
+		const FDecayEnvironmentProfile* Env = UDecayProfileDataAsset::ResolveEnvironmentProfile(ProfileTable, EnvTag);
+		if (!Env) continue;
+		if (!Env->AffectedItemTags.IsEmpty() && !ItemTags.HasAny(Env->AffectedItemTags)) continue;
 
-	const FGameplayTag& Type = Inventory->InventoryTypeTag;
+		Mult *= FMath::Max(0.f, Env->RateMultiplier);
+	}
+	return Mult;
+}
 
-	if (T_PlayerBackpack.IsValid() && Type.MatchesTagExact(T_PlayerBackpack))       { DecaySpeedMultiplier = 3.0f; EfficiencyRating = 0.5f;  }
-	else if (T_StorageChest.IsValid() && Type.MatchesTagExact(T_StorageChest))      { DecaySpeedMultiplier = 1.5f; EfficiencyRating = 1.5f;  }
-	else if (T_CoolStorage.IsValid() && Type.MatchesTagExact(T_CoolStorage))        { DecaySpeedMultiplier = 0.5f; EfficiencyRating = 2.0f;  }
-	else if (T_ColdStorage.IsValid() && Type.MatchesTagExact(T_ColdStorage))        { DecaySpeedMultiplier = 0.0f; EfficiencyRating = 2.5f;  }
-	else if (T_StoreHouse.IsValid() && Type.MatchesTagExact(T_StoreHouse))          { DecaySpeedMultiplier = 1.0f; EfficiencyRating = 1.75f; }
-	else if (T_Compost.IsValid() && Type.MatchesTagExact(T_Compost))                { DecaySpeedMultiplier = 5.0f; EfficiencyRating = 3.0f;  }
+void UDecayComponent::RebaseSlot(FDecaySlot& S, float Now)
+{
+	// DecayTimeRemaining is in item-seconds, so only the rate and the derived expiry move.
+	const float Rate = FMath::Max(0.f, DecaySpeedMultiplier) * S.EnvironmentMultiplier;
+	S.RateMultiplier = Rate;
+
+	UDecaySubsystem* Sub = GetDecaySubsystem();
+	if (Sub && S.StoreId != INDEX_NONE)
+	{
+		Sub->SetRate(S.StoreId, bDecayActive ? Rate : 0.f);
+		S.DecayTimeRemaining = Sub->GetRemaining(S.StoreId);
+		S.ExpireServerTime   = Sub->GetExpireTime(S.StoreId);
+		return;
+	}
+
+	S.ExpireServerTime = (bDecayActive && Rate > 0.f && S.DecayTimeRemaining > 0.f)
+		? Now + S.DecayTimeRemaining / Rate
+		: -1.f;
+}
+
+void UDecayComponent::RebaseSlots(bool bRecomputeEnvironment)
+{
+	if (!HasAuthoritySafe()) return;
+
+	if (bRecomputeEnvironment)
+	{
+		ActiveEnvironmentTags.Reset();
+		for (auto It = ActiveEnvironments.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+			ActiveEnvironmentTags.AppendTags(It.Value());
+		}
+	}
+
+	const float Now = GetServerTimeSeconds();
+	int32 NumRebased = 0;
+
+	for (FDecaySlot& S : DecaySlots)
+	{
+		if (S.SlotIndex < 0) continue;
+
+		if (bRecomputeEnvironment)
+		{
+			const float NewEnv = ComputeEnvironmentMultiplier(S.ItemTags);
+			if (FMath::IsNearlyEqual(NewEnv, S.EnvironmentMultiplier)) continue; // not affected
+			S.EnvironmentMultiplier = NewEnv;
+		}
+
+		RebaseSlot(S, Now);
+		++NumRebased;
+	}
+
+	if (bLogDecayDebug) UE_LOG(LogTemp, Log, TEXT("[Decay] Rebase -> %d of %d slots"), NumRebased, DecaySlots.Num());
+
+	if (NumRebased > 0)
+	{
+		PublishFromStore();
+	}
+}
+
+float UDecayComponent::GetServerTimeSeconds() const
+{
+	const UWorld* W = GetWorld();
+	if (!W) return 0.f;
+	if (const AGameStateBase* GS = W->GetGameState())
+	{
+		return static_cast<float>(GS->GetServerWorldTimeSeconds());
+	}
+	return W->GetTimeSeconds();
+}
+
+void UDecayComponent::GatherItemTags(const UItemDataAsset* Asset, FGameplayTagContainer& Out)
+{
+	Out.Reset();
+	if (!Asset) return;
+
+	Out.AddTag(Asset->ItemIDTag);
+	Out.AddTag(Asset->ItemType);
+	Out.AddTag(Asset->ItemCategory);
+	Out.AddTag(Asset->ItemSubCategory);
+	for (const FGameplayTag& T : Asset->AdditionalTags) Out.AddTag(T);
 }
 
 static FORCEINLINE bool SoftValid(const TSoftObjectPtr<UItemDataAsset>& S)
@@ -225,14 +404,14 @@ static FORCEINLINE bool SoftValid(const TSoftObjectPtr<UItemDataAsset>& S)
 UItemDataAsset* UDecayComponent::ResolveItemAsset(const FInventoryItem& SlotItem)
 {
 	if (SlotItem.ItemData.IsValid()) return SlotItem.ItemData.Get();
-	if (SlotItem.ItemData.ToSoftObjectPath().IsValid()) return SlotItem.ItemData.LoadSynchronous();
+	if (SlotItem.ItemData.ToSoftObjectPath().IsValid()) return InventorySyncLoad::Load(SlotItem.ItemData, TEXT("Decay.ResolveItemAsset"));
 	return nullptr;
 }
 
 UItemDataAsset* UDecayComponent::ResolveSoftItem(UItemDataAsset* MaybeLoaded, const TSoftObjectPtr<UItemDataAsset>& Soft)
 {
 	if (MaybeLoaded) return MaybeLoaded;
-	if (SoftValid(Soft)) return Soft.LoadSynchronous();
+	if (SoftValid(Soft)) return InventorySyncLoad::Load(Soft, TEXT("Decay.ResolveSoftItem"));
 	return nullptr;
 }
 
@@ -253,105 +432,103 @@ int32 UDecayComponent::RefreshDecaySlots()
 {
 	if (!HasAuthoritySafe()) return DecaySlots.Num();
 
+	ReleaseStoreEntries();
 	DecaySlots.Empty();
 
 	if (!Inventory)
 	{
 		if (bLogDecayDebug) UE_LOG(LogTemp, Log, TEXT("[Decay] Refresh: Inventory=NULL"));
-		bIsTrackingAny = false;
-		OnTrackingStateChanged.Broadcast(false);
+		UpdateTrackingState();
 		return 0;
 	}
 
 	const TArray<FInventoryItem>& Items = Inventory->GetItems();
-	const int32 Batch = FMath::Max(1, InputBatchSize);
+	const float Now = GetServerTimeSeconds();
 
 	for (int32 i=0; i<Items.Num(); ++i)
 	{
-		const FInventoryItem& Slot = Items[i];
-		if (Slot.Quantity < Batch) continue;
-
-		UItemDataAsset* Asset = ResolveItemAsset(Slot);
-		if (!Asset || !Asset->bCanDecay) continue;
-
-		const float Total = GetItemDecaySeconds(Asset);
-		if (Total <= 0.f) continue;
-
-		DecaySlots.Emplace(i, Total, Total, Batch);
+		TrackSlot(i, Items[i], Now);
 	}
 
-	const bool bNowTracking = DecaySlots.Num() > 0;
-	if (bNowTracking != bIsTrackingAny)
-	{
-		bIsTrackingAny = bNowTracking;
-		OnTrackingStateChanged.Broadcast(bIsTrackingAny);
-	}
+	UpdateTrackingState();
 
 	if (bLogDecayDebug) UE_LOG(LogTemp, Log, TEXT("[Decay] Refresh -> %d tracked"), DecaySlots.Num());
 	return DecaySlots.Num();
 }
 
-void UDecayComponent::TryStartStopFromCurrentState()
+int32 UDecayComponent::FindTrackedSlot(int32 SlotIndex) const
 {
-	if (!HasAuthoritySafe() || !IsInventoryValid())
-	{
-		StopTimer();
-		return;
-	}
-
-	if (bDecayActive && DecaySlots.Num() > 0 && !IsIdle())
-	{
-		StartTimer();
-	}
-	else
-	{
-		StopTimer();
-	}
+	return DecaySlots.IndexOfByPredicate([SlotIndex](const FDecaySlot& S) { return S.SlotIndex == SlotIndex; });
 }
 
-void UDecayComponent::StartTimer()
+bool UDecayComponent::TrackSlot(int32 SlotIndex, const FInventoryItem& Item, float Now)
 {
-	if (!GetWorld()) return;
-	if (!GetWorld()->GetTimerManager().IsTimerActive(DecayTimerHandle))
+	const int32 Batch = FMath::Max(1, InputBatchSize);
+	if (Item.Quantity < Batch) return false;
+
+	UItemDataAsset* Asset = ResolveItemAsset(Item);
+	if (!Asset || !Asset->bCanDecay) return false;
+
+	const float Total = GetItemDecaySeconds(Asset);
+	if (Total <= 0.f) return false;
+
+	FDecaySlot& S = DecaySlots.Emplace_GetRef(SlotIndex, Total, Total, Batch);
+	S.ItemIDTag = Asset->ItemIDTag;
+	GatherItemTags(Asset, S.ItemTags);
+	S.EnvironmentMultiplier = ComputeEnvironmentMultiplier(S.ItemTags);
+
+	UDecaySubsystem* Sub = GetDecaySubsystem();
+	if (Sub && StoreOwnerHandle != INDEX_NONE)
 	{
-		GetWorld()->GetTimerManager().SetTimer(
-			DecayTimerHandle, this, &UDecayComponent::DecayTimerTick,
-			FMath::Max(0.05f, DecayCheckInterval), true
-		);
+		S.StoreId = Sub->AddEntry(StoreOwnerHandle, SlotIndex, Total, Total, 0.f, Item.Quantity / Batch);
 	}
+	RebaseSlot(S, Now);
+	return true;
 }
 
-void UDecayComponent::StopTimer()
+void UDecayComponent::UntrackAt(int32 TrackedIndex)
 {
-	if (!GetWorld()) return;
-	GetWorld()->GetTimerManager().ClearTimer(DecayTimerHandle);
-}
+	if (!DecaySlots.IsValidIndex(TrackedIndex)) return;
 
-bool UDecayComponent::ConsumeInputAtSlot_Server(int32 SlotIndex, int32 Quantity)
-{
-	if (!IsInventoryValid() || Quantity <= 0) return false;
-	return Inventory->RemoveItem(SlotIndex, Quantity); // direct, server-only
+	const int32 StoreId = DecaySlots[TrackedIndex].StoreId;
+	if (UDecaySubsystem* Sub = GetDecaySubsystem(); Sub && StoreId != INDEX_NONE)
+	{
+		Sub->RemoveEntry(StoreId);
+	}
+	DecaySlots.RemoveAtSwap(TrackedIndex);
 }
 
-void UDecayComponent::CompactTrackedSlots()
+void UDecayComponent::ReconcileSlot(int32 SlotIndex, float Now)
 {
-	if (!HasAuthoritySafe()) return;
+	const FInventoryItem Curr = Inventory ? Inventory->GetItem(SlotIndex) : FInventoryItem();
+	const int32 Tracked = FindTrackedSlot(SlotIndex);
 
-	DecaySlots.RemoveAll([this](const FDecaySlot& S)
+	if (Tracked != INDEX_NONE)
 	{
-		if (!Inventory) return true;
-		if (S.SlotIndex < 0 || S.DecayTimeRemaining <= 0.f) return true;
-
-		const FInventoryItem Curr = Inventory->GetItem(S.SlotIndex);
-		if (Curr.Quantity < S.BatchSize) return true;
+		FDecaySlot& S = DecaySlots[Tracked];
+		const UItemDataAsset* Asset = Curr.Quantity >= S.BatchSize ? ResolveItemAsset(Curr) : nullptr;
 
-		UItemDataAsset* Asset = ResolveItemAsset(Curr);
-		if (!Asset || !Asset->bCanDecay) return true;
+		// Same item, new quantity: keep the running batch, only the number of batches it can feed changes.
+		if (Asset && Asset->bCanDecay && Asset->ItemIDTag == S.ItemIDTag)
+		{
+			if (UDecaySubsystem* Sub = GetDecaySubsystem(); Sub && S.StoreId != INDEX_NONE)
+			{
+				Sub->SetAvailableBatches(S.StoreId, Curr.Quantity / S.BatchSize);
+				S.DecayTimeRemaining = Sub->GetRemaining(S.StoreId);
+				S.ExpireServerTime   = Sub->GetExpireTime(S.StoreId);
+			}
+			return;
+		}
+		UntrackAt(Tracked);
+	}
 
-		return false;
-	});
+	TrackSlot(SlotIndex, Curr, Now);
+}
 
-	const bool bNowTracking = DecaySlots.Num() > 0;
+void UDecayComponent::UpdateTrackingState()
+{
+	// The one place tracking flips, so each transition broadcasts exactly once.
+	const bool bNowTracking = DecaySlots.Num() > 0 && !(bAutoStopWhenIdle && IsIdle());
 	if (bNowTracking != bIsTrackingAny)
 	{
 		bIsTrackingAny = bNowTracking;
@@ -359,114 +536,156 @@ void UDecayComponent::CompactTrackedSlots()
 	}
 }
 
-// --- Tick ---
-void UDecayComponent::DecayTimerTick()
+bool UDecayComponent::ConsumeInputAtSlot_Server(int32 SlotIndex, int32 Quantity)
 {
-	if (!HasAuthoritySafe() || !IsInventoryValid())
-	{
-		StopTimer();
-		return;
-	}
+	if (!IsInventoryValid() || Quantity <= 0) return false;
+	return Inventory->RemoveItem(SlotIndex, Quantity); // direct, server-only
+}
+
+// --- Store ---
+UDecaySubsystem* UDecayComponent::GetDecaySubsystem() const
+{
+	const UWorld* W = GetWorld();
+	return W ? W->GetSubsystem<UDecaySubsystem>() : nullptr;
+}
 
-	if (!bDecayActive || DecaySlots.Num() == 0)
+void UDecayComponent::ReleaseStoreEntries()
+{
+	UDecaySubsystem* Sub = GetDecaySubsystem();
+	for (FDecaySlot& S : DecaySlots)
 	{
-		StopTimer();
-		return;
+		if (Sub && S.StoreId != INDEX_NONE)
+		{
+			Sub->RemoveEntry(S.StoreId);
+		}
+		S.StoreId = INDEX_NONE;
 	}
+}
 
-	bTickInProgress = true;
-
-	bool bAnyCountingDown = false;
-	const float Speed = FMath::Max(0.f, DecaySpeedMultiplier);
+void UDecayComponent::ApplyDecayCompletions(TArrayView<const FDecayCompletion> Completions)
+{
+	if (!HasAuthoritySafe() || !IsInventoryValid()) return;
 
-	for (int32 idx = 0; idx < DecaySlots.Num(); ++idx)
+	// Inventory edits below re-enter HandleInventoryDelta, which may add/remove tracked slots,
+	// so every lookup goes through the stable StoreId and no FDecaySlot reference is held across them.
+	for (const FDecayCompletion& C : Completions)
 	{
-		FDecaySlot& S = DecaySlots[idx];
-		if (S.SlotIndex < 0) continue;
+		const int32 Tracked = DecaySlots.IndexOfByPredicate([&C](const FDecaySlot& X) { return X.StoreId == C.StoreId; });
+		if (Tracked == INDEX_NONE) continue;
 
-		const FInventoryItem Curr = Inventory->GetItem(S.SlotIndex);
-		if (Curr.Quantity < S.BatchSize) { S.DecayTimeRemaining = -1.f; continue; }
+		const int32 SlotIndex = DecaySlots[Tracked].SlotIndex;
+		const int32 BatchSize = FMath::Max(1, DecaySlots[Tracked].BatchSize);
 
+		const FInventoryItem Curr = Inventory->GetItem(SlotIndex);
 		UItemDataAsset* Asset = ResolveItemAsset(Curr);
-		if (!Asset || !Asset->bCanDecay) { S.DecayTimeRemaining = -1.f; continue; }
+		if (!Asset || !Asset->bCanDecay) { ReconcileSlot(SlotIndex, GetServerTimeSeconds()); continue; }
 
-		if (Speed <= 0.f)
-		{
-			OnDecayProgress.Broadcast(S.SlotIndex, S.DecayTimeRemaining, S.TotalDecayTime);
-			continue;
-		}
-
-		S.DecayTimeRemaining -= (DecayCheckInterval * Speed);
-		OnDecayProgress.Broadcast(S.SlotIndex, S.DecayTimeRemaining, S.TotalDecayTime);
+		// The store may count more batches than the stack still holds; reserved units can't be withdrawn either.
+		const int32 Withdrawable = FMath::Min(Curr.Quantity, Inventory->GetAvailableQuantity(Asset->ItemIDTag));
+		const int32 Batches = FMath::Min(C.Count, Withdrawable / BatchSize);
+		if (Batches <= 0) { ReconcileSlot(SlotIndex, GetServerTimeSeconds()); continue; }
 
-		if (S.DecayTimeRemaining > 0.f)
-		{
-			bAnyCountingDown = true;
-			continue;
-		}
-
-		// batch completes
-		const int32 InputUsed = S.BatchSize;
+		// Consume first: the delta re-syncs the entry's available batches and keeps its phase.
+		// Output only for what actually left the stack.
+		if (!ConsumeInputAtSlot_Server(SlotIndex, Batches * BatchSize)) continue;
 
 		UItemDataAsset* OutAsset = ResolveSoftItem(nullptr, Asset->DecaysInto);
 		if (OutAsset)
 		{
-			const int32 OutQty = CalculateBatchOutput(InputUsed);
+			const int32 OutQty = Batches * CalculateBatchOutput(BatchSize);
 			Inventory->TryAddItem(OutAsset, OutQty);
-			OnItemDecayed.Broadcast(S.SlotIndex, OutAsset, OutQty);
+			OnItemDecayed.Broadcast(SlotIndex, OutAsset, OutQty);
 		}
+	}
+
+	UpdateTrackingState();
+	PublishFromStore();
+}
+
+void UDecayComponent::PublishFromStore()
+{
+	// Runs after slot, rate and completion changes instead of on a timer, so DecaySlots only
+	// replicates when an expiry or state moved; clients extrapolate from ExpireServerTime.
+	if (!HasAuthoritySafe()) return;
+
+	UDecaySubsystem* Sub = GetDecaySubsystem();
+	const float Speed = FMath::Max(0.f, DecaySpeedMultiplier);
+	const float Now = GetServerTimeSeconds();
 
-		ConsumeInputAtSlot_Server(S.SlotIndex, InputUsed);
+	for (FDecaySlot& S : DecaySlots)
+	{
+		if (S.SlotIndex < 0) continue;
 
-		const FInventoryItem After = Inventory->GetItem(S.SlotIndex);
-		if (After.Quantity >= S.BatchSize && Asset->bCanDecay)
+		if (!FMath::IsNearlyEqual(Speed * S.EnvironmentMultiplier, S.RateMultiplier))
 		{
-			const float Total = GetItemDecaySeconds(Asset);
-			S.TotalDecayTime = Total;
-			S.DecayTimeRemaining = Total;
-			bAnyCountingDown = true;
+			RebaseSlot(S, Now); // speed was written directly (BP); keep the store and replicated expiry honest
 		}
-		else
+		else if (Sub && S.StoreId != INDEX_NONE)
 		{
-			S.DecayTimeRemaining = -1.f;
+			S.DecayTimeRemaining = Sub->GetRemaining(S.StoreId);
+			S.ExpireServerTime   = Sub->GetExpireTime(S.StoreId);
 		}
+		OnDecayProgress.Broadcast(S.SlotIndex, S.DecayTimeRemaining, S.TotalDecayTime);
 	}
 
-	bTickInProgress = false;
+	UpdateTrackingState();
+}
 
-	CompactTrackedSlots();
+// --- Inventory change hook ---
+void UDecayComponent::HandleInventoryDelta(UInventoryComponent* Changed, const FInventoryDelta& Delta)
+{
+	if (!HasAuthoritySafe() || Changed != Inventory) return;
 
-	if (bRefreshRequested)
-	{
-		bRefreshRequested = false;
-		RefreshDecaySlots();
-	}
+	const float Now = GetServerTimeSeconds();
 
-	if (bAutoStopWhenIdle && !bAnyCountingDown)
+	if (Delta.bFullRefresh)
 	{
-		StopIfIdle();
-		return;
+		// Reconcile every slot rather than rebuilding, so unchanged stacks keep their progress.
+		const int32 NumSlots = Inventory->GetItems().Num();
+		for (int32 i = DecaySlots.Num() - 1; i >= 0; --i)
+		{
+			if (DecaySlots[i].SlotIndex >= NumSlots) UntrackAt(i);
+		}
+		for (int32 i = 0; i < NumSlots; ++i)
+		{
+			ReconcileSlot(i, Now);
+		}
 	}
-
-	if (!bIsTrackingAny || DecaySlots.Num() == 0)
+	else
 	{
-		StopTimer();
+		// Moves form a permutation; remap in one pass so chained moves (A->B, B->A) don't collide.
+		if (Delta.Moves.Num() > 0)
+		{
+			TMap<int32, int32> FromTo;
+			FromTo.Reserve(Delta.Moves.Num());
+			for (const TPair<int32, int32>& Move : Delta.Moves) FromTo.Add(Move.Key, Move.Value);
+
+			UDecaySubsystem* Sub = GetDecaySubsystem();
+			for (FDecaySlot& S : DecaySlots)
+			{
+				if (const int32* To = FromTo.Find(S.SlotIndex))
+				{
+					S.SlotIndex = *To;
+					if (Sub && S.StoreId != INDEX_NONE) Sub->SetSlotIndex(S.StoreId, *To);
+				}
+			}
+		}
+
+		for (const int32 SlotIndex : Delta.ChangedSlots)
+		{
+			ReconcileSlot(SlotIndex, Now);
+		}
 	}
-}
 
-// --- Inventory change hook ---
-void UDecayComponent::OnInventoryChangedRefresh()
-{
-	if (!HasAuthoritySafe()) return;
+	UpdateTrackingState();
 
-	if (bTickInProgress)
+	if (bLogDecayDebug)
 	{
-		bRefreshRequested = true;
-		return;
+		UE_LOG(LogTemp, Log, TEXT("[Decay] Delta: %d moved, %d changed%s -> %d tracked"),
+			Delta.Moves.Num(), Delta.ChangedSlots.Num(), Delta.bFullRefresh ? TEXT(", full") : TEXT(""), DecaySlots.Num());
 	}
 
-	RefreshDecaySlots();
-	TryStartStopFromCurrentState();
+	PublishFromStore();
 }
 
 // --- RepNotifies ---
@@ -490,13 +709,13 @@ void UDecayComponent::OnRep_IsTrackingAny()
 void UDecayComponent::Server_StartDecay_Implementation()
 {
 	bDecayActive = true;
-	TryStartStopFromCurrentState();
+	RebaseSlots(false);
 }
 bool UDecayComponent::Server_StartDecay_Validate() { return true; }
 
 void UDecayComponent::Server_StopDecay_Implementation()
 {
 	bDecayActive = false;
-	TryStartStopFromCurrentState();
+	RebaseSlots(false);
 }
 bool UDecayComponent::Server_StopDecay_Validate() { return true; }
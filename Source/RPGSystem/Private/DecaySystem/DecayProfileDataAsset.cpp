@@ -0,0 +1,124 @@
+#include "DecaySystem/DecayProfileDataAsset.h"
+#include "GAS/RPGGameplayTags.h"
+
+namespace
+{
+	// Built-in defaults, used when no ProfileTable is assigned. Built once on first use.
+	struct FBuiltInDecayProfiles
+	{
+		TMap<FGameplayTag, FDecayStorageProfile>     Storage;
+		TMap<FGameplayTag, FDecayEnvironmentProfile> Environment;
+
+		FBuiltInDecayProfiles()
+		{
+			AddStorage(TAG_Inventory_Type_PlayerBag,   3.0f, 0.5f);
+			AddStorage(TAG_Inventory_Type_Storage,     1.5f, 1.5f);
+			AddStorage(TAG_Inventory_Type_CoolStorage, 0.5f, 2.0f);
+			AddStorage(TAG_Inventory_Type_ColdStorage, 0.0f, 2.5f);
+			AddStorage(TAG_Inventory_Type_StoreHouse,  1.0f, 1.75f);
+			AddStorage(TAG_Inventory_Type_Compost,     5.0f, 3.0f);
+
+			AddEnvironment(TAG_Zone_Climate_Cold, 0.5f);
+			AddEnvironment(TAG_Zone_Climate_Warm, 1.5f);
+		}
+
+		void AddStorage(const FGameplayTag& Tag, float Speed, float Efficiency)
+		{
+			FDecayStorageProfile& P = Storage.Add(Tag);
+			P.InventoryTypeTag     = Tag;
+			P.DecaySpeedMultiplier = Speed;
+			P.EfficiencyRating     = Efficiency;
+		}
+
+		void AddEnvironment(const FGameplayTag& Tag, float Multiplier)
+		{
+			FDecayEnvironmentProfile& P = Environment.Add(Tag);
+			P.EnvironmentTag = Tag;
+			P.RateMultiplier = Multiplier;
+		}
+	};
+
+	const FBuiltInDecayProfiles& GetBuiltInProfiles()
+	{
+		static const FBuiltInDecayProfiles BuiltIn;
+		return BuiltIn;
+	}
+}
+
+void UDecayProfileDataAsset::PostLoad()
+{
+	Super::PostLoad();
+	bCacheBuilt = false;
+}
+
+#if WITH_EDITOR
+void UDecayProfileDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	bCacheBuilt = false;
+}
+#endif
+
+void UDecayProfileDataAsset::BuildCache() const
+{
+	StorageIndex.Reset();
+	EnvironmentIndex.Reset();
+
+	for (int32 i = 0; i < StorageProfiles.Num(); ++i)
+	{
+		if (StorageProfiles[i].InventoryTypeTag.IsValid())
+		{
+			StorageIndex.Add(StorageProfiles[i].InventoryTypeTag, i);
+		}
+	}
+	for (int32 i = 0; i < EnvironmentProfiles.Num(); ++i)
+	{
+		if (EnvironmentProfiles[i].EnvironmentTag.IsValid())
+		{
+			EnvironmentIndex.Add(EnvironmentProfiles[i].EnvironmentTag, i);
+		}
+	}
+	bCacheBuilt = true;
+}
+
+const FDecayStorageProfile* UDecayProfileDataAsset::FindStorageProfile(const FGameplayTag& InventoryTypeTag) const
+{
+	if (!InventoryTypeTag.IsValid()) return nullptr;
+	if (!bCacheBuilt) BuildCache();
+
+	const int32* Idx = StorageIndex.Find(InventoryTypeTag);
+	return Idx ? &StorageProfiles[*Idx] : nullptr;
+}
+
+const FDecayEnvironmentProfile* UDecayProfileDataAsset::FindEnvironmentProfile(const FGameplayTag& EnvironmentTag) const
+{
+	if (!EnvironmentTag.IsValid()) return nullptr;
+	if (!bCacheBuilt) BuildCache();
+
+	const int32* Idx = EnvironmentIndex.Find(EnvironmentTag);
+	return Idx ? &EnvironmentProfiles[*Idx] : nullptr;
+}
+
+const FDecayStorageProfile* UDecayProfileDataAsset::ResolveStorageProfile(const UDecayProfileDataAsset* Table, const FGameplayTag& InventoryTypeTag)
+{
+	if (Table)
+	{
+		if (const FDecayStorageProfile* Found = Table->FindStorageProfile(InventoryTypeTag))
+		{
+			return Found;
+		}
+	}
+	return GetBuiltInProfiles().Storage.Find(InventoryTypeTag);
+}
+
+const FDecayEnvironmentProfile* UDecayProfileDataAsset::ResolveEnvironmentProfile(const UDecayProfileDataAsset* Table, const FGameplayTag& EnvironmentTag)
+{
+	if (Table)
+	{
+		if (const FDecayEnvironmentProfile* Found = Table->FindEnvironmentProfile(EnvironmentTag))
+		{
+			return Found;
+		}
+	}
+	return GetBuiltInProfiles().Environment.Find(EnvironmentTag);
+}
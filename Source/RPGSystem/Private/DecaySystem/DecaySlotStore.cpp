@@ -0,0 +1,214 @@
+#include "DecaySystem/DecaySlotStore.h"
+#include "Async/ParallelFor.h"
+
+namespace DecayStore
+{
+	// Entries per ParallelFor task; below one chunk the kernel stays on the calling thread.
+	constexpr int32 ChunkSize = 16 * 1024;
+}
+
+int32 FDecaySlotStore::Add(int32 InOwner, int32 InSlotIndex, float InTotal, float InRemaining, float InRate, int32 InAvailable, double Now)
+{
+	const int32 Dense = ExpireTime.Num();
+
+	int32 Id;
+	if (FreeIds.Num() > 0)
+	{
+		Id = FreeIds.Pop(EAllowShrinking::No);
+		IdToDense[Id] = Dense;
+	}
+	else
+	{
+		Id = IdToDense.Add(Dense);
+	}
+
+	ExpireTime.Add(Stalled);
+	Rate.Add(FMath::Max(0.f, InRate));
+	Total.Add(FMath::Max(0.f, InTotal));
+	AvailableBatches.Add(FMath::Max(0, InAvailable));
+	Completions.Add(0);
+	Remaining.Add(FMath::Max(0.f, InRemaining));
+	SlotIndex.Add(InSlotIndex);
+	Owner.Add(InOwner);
+	DenseToId.Add(Id);
+
+	Restart(Dense, Now);
+	return Id;
+}
+
+void FDecaySlotStore::Remove(int32 Id)
+{
+	if (!IsValidId(Id)) return;
+
+	const int32 Dense = IdToDense[Id];
+	const int32 Last  = ExpireTime.Num() - 1;
+
+	if (Dense != Last)
+	{
+		const int32 MovedId = DenseToId[Last];
+		IdToDense[MovedId] = Dense;
+	}
+
+	ExpireTime.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Rate.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Total.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	AvailableBatches.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Completions.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Remaining.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	SlotIndex.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Owner.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	DenseToId.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+
+	IdToDense[Id] = INDEX_NONE;
+	FreeIds.Add(Id);
+}
+
+void FDecaySlotStore::Reset()
+{
+	ExpireTime.Reset();
+	Rate.Reset();
+	Total.Reset();
+	AvailableBatches.Reset();
+	Completions.Reset();
+	Remaining.Reset();
+	SlotIndex.Reset();
+	Owner.Reset();
+	DenseToId.Reset();
+	IdToDense.Reset();
+	FreeIds.Reset();
+}
+
+float FDecaySlotStore::GetRemainingDense(int32 Dense, double Now) const
+{
+	if (ExpireTime[Dense] == Stalled) return Remaining[Dense];
+	return static_cast<float>(FMath::Max(0.0, (ExpireTime[Dense] - Now) * Rate[Dense]));
+}
+
+void FDecaySlotStore::Restart(int32 Dense, double Now)
+{
+	const bool bRuns = Rate[Dense] > 0.f && AvailableBatches[Dense] > 0 && Remaining[Dense] > 0.f;
+	ExpireTime[Dense] = bRuns ? Now + Remaining[Dense] / Rate[Dense] : Stalled;
+}
+
+float FDecaySlotStore::GetRemaining(int32 Id, double Now) const
+{
+	return IsValidId(Id) ? GetRemainingDense(IdToDense[Id], Now) : -1.f;
+}
+
+double FDecaySlotStore::GetExpireTime(int32 Id) const
+{
+	return IsValidId(Id) ? ExpireTime[IdToDense[Id]] : Stalled;
+}
+
+double FDecaySlotStore::SetRate(int32 Id, float NewRate, double Now)
+{
+	if (!IsValidId(Id)) return Stalled;
+
+	const int32 Dense = IdToDense[Id];
+	Remaining[Dense] = GetRemainingDense(Dense, Now);
+	Rate[Dense]      = FMath::Max(0.f, NewRate);
+	Restart(Dense, Now);
+	return ExpireTime[Dense];
+}
+
+void FDecaySlotStore::SetSlotIndex(int32 Id, int32 NewSlotIndex)
+{
+	if (IsValidId(Id)) SlotIndex[IdToDense[Id]] = NewSlotIndex;
+}
+
+double FDecaySlotStore::SetAvailableBatches(int32 Id, int32 NumBatches, double Now)
+{
+	if (!IsValidId(Id)) return Stalled;
+
+	const int32 Dense = IdToDense[Id];
+	Remaining[Dense]        = GetRemainingDense(Dense, Now);
+	AvailableBatches[Dense] = FMath::Max(0, NumBatches);
+	Restart(Dense, Now);
+	return ExpireTime[Dense];
+}
+
+double FDecaySlotStore::Evaluate(double Now, TArray<FDecayCompletion>& OutCompleted)
+{
+	const int32 N = ExpireTime.Num();
+	if (N == 0) return Stalled;
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(N, DecayStore::ChunkSize);
+	TArray<double, TInlineAllocator<64>> ChunkNext;
+	ChunkNext.SetNumUninitialized(NumChunks);
+
+	double* RESTRICT E      = ExpireTime.GetData();
+	const float* RESTRICT R = Rate.GetData();
+	const float* RESTRICT T = Total.GetData();
+	int32* RESTRICT Avail   = AvailableBatches.GetData();
+	int32* RESTRICT K       = Completions.GetData();
+	float* RESTRICT Rem     = Remaining.GetData();
+
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		const int32 Begin = Chunk * DecayStore::ChunkSize;
+		const int32 End   = FMath::Min(Begin + DecayStore::ChunkSize, N);
+		double Next = Stalled;
+
+		for (int32 i = Begin; i < End; ++i)
+		{
+			int32 Done = 0;
+			if (E[i] <= Now)
+			{
+				// Finite expiry implies Rate > 0 and Avail > 0.
+				const double Period = T[i] / R[i];
+				const double Late   = Now - E[i];
+				Done = (Period > 0.0)
+					? static_cast<int32>(FMath::Min<double>(Avail[i], 1.0 + FMath::FloorToDouble(Late / Period)))
+					: Avail[i];
+
+				Avail[i] -= Done;
+				if (Avail[i] > 0)
+				{
+					E[i] += Done * Period;
+				}
+				else
+				{
+					E[i]   = Stalled;
+					Rem[i] = T[i];
+				}
+			}
+			K[i] = Done;
+			Next = FMath::Min(Next, E[i]);
+		}
+		ChunkNext[Chunk] = Next;
+	}, NumChunks == 1);
+
+	double Next = Stalled;
+	for (const double C : ChunkNext) Next = FMath::Min(Next, C);
+
+	for (int32 i = 0; i < N; ++i)
+	{
+		if (K[i] == 0) continue;
+
+		FDecayCompletion& C = OutCompleted.AddDefaulted_GetRef();
+		C.StoreId   = DenseToId[i];
+		C.Owner     = Owner[i];
+		C.SlotIndex = SlotIndex[i];
+		C.Count     = K[i];
+	}
+	return Next;
+}
+
+void FDecaySlotStore::Shift(double Seconds)
+{
+	const int32 N = ExpireTime.Num();
+	if (N == 0 || Seconds <= 0.0) return;
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(N, DecayStore::ChunkSize);
+	double* RESTRICT E = ExpireTime.GetData();
+
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		const int32 Begin = Chunk * DecayStore::ChunkSize;
+		const int32 End   = FMath::Min(Begin + DecayStore::ChunkSize, N);
+		for (int32 i = Begin; i < End; ++i)
+		{
+			if (E[i] != Stalled) E[i] -= Seconds;
+		}
+	}, NumChunks == 1);
+}
@@ -0,0 +1,211 @@
+#include "DecaySystem/DecaySubsystem.h"
+#include "DecaySystem/DecayComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+
+bool UDecaySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && World->GetNetMode() != NM_Client;
+}
+
+void UDecaySubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ProcessTimerHandle);
+	}
+	Store.Reset();
+	Owners.Reset();
+	FreeOwners.Reset();
+	Super::Deinitialize();
+}
+
+double UDecaySubsystem::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+// --- Owners ---
+int32 UDecaySubsystem::RegisterOwner(UDecayComponent* Component)
+{
+	if (!Component) return INDEX_NONE;
+
+	if (FreeOwners.Num() > 0)
+	{
+		const int32 Handle = FreeOwners.Pop(EAllowShrinking::No);
+		Owners[Handle] = Component;
+		return Handle;
+	}
+	return Owners.Add(Component);
+}
+
+void UDecaySubsystem::UnregisterOwner(int32 OwnerHandle)
+{
+	if (!Owners.IsValidIndex(OwnerHandle)) return;
+	Owners[OwnerHandle].Reset();
+	FreeOwners.Add(OwnerHandle);
+}
+
+// --- Entries ---
+int32 UDecaySubsystem::AddEntry(int32 OwnerHandle, int32 SlotIndex, float Total, float Remaining, float Rate, int32 AvailableBatches)
+{
+	const int32 Id = Store.Add(OwnerHandle, SlotIndex, Total, Remaining, Rate, AvailableBatches, GetNow());
+	NoteExpiry(Store.GetExpireTime(Id));
+	return Id;
+}
+
+void UDecaySubsystem::RemoveEntry(int32 StoreId)
+{
+	// A stale ScheduledExpiry only causes one early, empty evaluation.
+	Store.Remove(StoreId);
+}
+
+void UDecaySubsystem::SetRate(int32 StoreId, float Rate)
+{
+	NoteExpiry(Store.SetRate(StoreId, Rate, GetNow()));
+}
+
+void UDecaySubsystem::SetAvailableBatches(int32 StoreId, int32 NumBatches)
+{
+	NoteExpiry(Store.SetAvailableBatches(StoreId, NumBatches, GetNow()));
+}
+
+float UDecaySubsystem::GetRemaining(int32 StoreId) const
+{
+	return Store.GetRemaining(StoreId, GetNow());
+}
+
+float UDecaySubsystem::GetExpireTime(int32 StoreId) const
+{
+	const double Expiry = Store.GetExpireTime(StoreId);
+	return Expiry == FDecaySlotStore::Stalled ? -1.f : static_cast<float>(Expiry);
+}
+
+// --- Scheduling ---
+void UDecaySubsystem::NoteExpiry(double Expiry)
+{
+	if (bProcessing)
+	{
+		ProcessingMinExpiry = FMath::Min(ProcessingMinExpiry, Expiry);
+		return;
+	}
+	if (Expiry >= ScheduledExpiry) return;
+	ScheduleNext(Expiry);
+}
+
+void UDecaySubsystem::ScheduleNext(double NextExpiry)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	ScheduledExpiry = NextExpiry;
+	if (NextExpiry == FDecaySlotStore::Stalled)
+	{
+		World->GetTimerManager().ClearTimer(ProcessTimerHandle);
+		return;
+	}
+
+	// SetTimer treats <= 0 as "clear", so due-now work waits one tiny step.
+	const float Delay = FMath::Max(0.001f, static_cast<float>(NextExpiry - GetNow()));
+	World->GetTimerManager().SetTimer(ProcessTimerHandle, this, &UDecaySubsystem::ProcessDue, Delay, false);
+}
+
+void UDecaySubsystem::ProcessDue()
+{
+	TArray<FDecayCompletion> Completed;
+
+	bProcessing = true;
+	ProcessingMinExpiry = FDecaySlotStore::Stalled;
+	const double NextExpiry = Store.Evaluate(GetNow(), Completed);
+
+	// Group by owner so each component applies its batch once; components may add/remove entries while applying.
+	Completed.Sort([](const FDecayCompletion& A, const FDecayCompletion& B) { return A.Owner < B.Owner; });
+
+	for (int32 Begin = 0; Begin < Completed.Num(); )
+	{
+		int32 End = Begin + 1;
+		while (End < Completed.Num() && Completed[End].Owner == Completed[Begin].Owner) ++End;
+
+		const int32 Handle = Completed[Begin].Owner;
+		if (Owners.IsValidIndex(Handle))
+		{
+			if (UDecayComponent* Component = Owners[Handle].Get())
+			{
+				Component->ApplyDecayCompletions(MakeArrayView(Completed.GetData() + Begin, End - Begin));
+			}
+		}
+		Begin = End;
+	}
+	bProcessing = false;
+
+	// Evaluate already found the earliest survivor; entries added or re-timed while applying were noted above.
+	// Entries removed meanwhile can only make this early, which costs one empty evaluation.
+	ScheduleNext(FMath::Min(NextExpiry, ProcessingMinExpiry));
+}
+
+void UDecaySubsystem::FastForward(float Seconds)
+{
+	if (Seconds <= 0.f) return;
+
+	Store.Shift(Seconds);
+	ProcessDue();
+
+	for (const TWeakObjectPtr<UDecayComponent>& Owner : Owners)
+	{
+		if (UDecayComponent* Component = Owner.Get())
+		{
+			Component->PublishFromStore();
+		}
+	}
+}
+
+// --- Console ---
+static FAutoConsoleCommandWithWorldAndArgs GDecayFastForwardCmd(
+	TEXT("Decay.FastForward"),
+	TEXT("Decay.FastForward <Seconds> - advance every tracked decay stack on the server."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UDecaySubsystem* Decay = World ? World->GetSubsystem<UDecaySubsystem>() : nullptr;
+		if (!Decay || Args.Num() < 1) return;
+
+		const double Start = FPlatformTime::Seconds();
+		Decay->FastForward(FCString::Atof(*Args[0]));
+		UE_LOG(LogTemp, Log, TEXT("[Decay] FastForward %s s over %d stacks in %.2f ms"),
+			*Args[0], Decay->GetNumTrackedStacks(), (FPlatformTime::Seconds() - Start) * 1000.0);
+	}));
+
+static FAutoConsoleCommand GDecayBenchCmd(
+	TEXT("Decay.Bench"),
+	TEXT("Decay.Bench [NumStacks=1000000] - time the decay kernel on a synthetic store."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumStacks = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+
+		FDecaySlotStore Bench;
+		FRandomStream Rng(1337);
+		for (int32 i = 0; i < NumStacks; ++i)
+		{
+			const float Total = Rng.FRandRange(60.f, 3600.f);
+			Bench.Add(i / 32, i % 32, Total, Rng.FRandRange(1.f, Total), Rng.FRandRange(0.f, 3.f), Rng.RandRange(1, 20), 0.0);
+		}
+
+		TArray<FDecayCompletion> Completed;
+		Completed.Reserve(NumStacks);
+
+		double Start = FPlatformTime::Seconds();
+		Bench.Evaluate(1.0, Completed);
+		const double TickMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+		const int32 TickDone = Completed.Num();
+
+		Completed.Reset();
+		Start = FPlatformTime::Seconds();
+		Bench.Shift(7.0 * 24.0 * 3600.0);
+		Bench.Evaluate(1.0, Completed);
+		const double SkipMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		UE_LOG(LogTemp, Log, TEXT("[Decay] Bench %d stacks: tick %.2f ms (%d done), 1 week skip %.2f ms (%d done)"),
+			NumStacks, TickMs, TickDone, SkipMs, Completed.Num());
+	}));
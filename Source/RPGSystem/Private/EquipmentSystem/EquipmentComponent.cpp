@@ -6,6 +6,7 @@
 #include "Inventory/InventoryItem.h"
 #include "Inventory/ItemDataAsset.h"
 #include "Inventory/InventoryHelpers.h"
+#include "Inventory/SyncLoadStats.h"
 #include "Net/UnrealNetwork.h"
 
 UEquipmentComponent::UEquipmentComponent()
@@ -14,6 +15,22 @@ UEquipmentComponent::UEquipmentComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
+void UEquipmentComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ResidencyPins.Reset();
+	Super::EndPlay(EndPlayReason);
+}
+
+void UEquipmentComponent::RefreshResidencyPins()
+{
+	TArray<FSoftObjectPath, TInlineAllocator<16>> Paths;
+	for (const FEquippedEntry& E : Equipped)
+	{
+		Paths.Add(E.ItemData.ToSoftObjectPath());
+	}
+	ResidencyPins.Sync(Paths);
+}
+
 void UEquipmentComponent::GetAllSlotDefs(TArray<FEquipmentSlotDef>& OutDefs) const
 {
 	OutDefs.Reset(WeaponSlotDefs.Num() + ArmorSlotDefs.Num());
@@ -61,6 +78,8 @@ void UEquipmentComponent::InitializeSlotsFromDefinitions(bool bOnlyIfEmpty)
 		const bool bHas = (FindEntry(Def.SlotTag) != nullptr);
 		if (bOnlyIfEmpty && bHas) return;
 
+		InventorySyncLoad::FCallSite Site(TEXT("Equipment.InitializeSlotsFromDefinitions"));
+
 		UItemDataAsset* Data = nullptr;
 		if (Def.ItemIDTag.IsValid())
 		{
@@ -68,7 +87,7 @@ void UEquipmentComponent::InitializeSlotsFromDefinitions(bool bOnlyIfEmpty)
 		}
 		if (!Data && !Def.ItemData.IsNull())
 		{
-			Data = Def.ItemData.LoadSynchronous();
+			Data = InventorySyncLoad::Load(Def.ItemData, TEXT("Equipment.InitializeSlotsFromDefinitions"));
 		}
 		if (!Data) return;
 
@@ -80,6 +99,7 @@ void UEquipmentComponent::InitializeSlotsFromDefinitions(bool bOnlyIfEmpty)
 
 	for (const FEquipmentSlotDef& D : WeaponSlotDefs) { TryInit(D); }
 	for (const FEquipmentSlotDef& D : ArmorSlotDefs)  { TryInit(D); }
+	RefreshResidencyPins();
 
 	// Fire events for current snapshot
 	for (const FEquippedEntry& E : Equipped)
@@ -143,12 +163,14 @@ UItemDataAsset* UEquipmentComponent::ResolveData(const FEquippedEntry& E) const
 	if (E.ItemData.IsValid())
 		return E.ItemData.Get();
 	if (!E.ItemData.IsNull())
-		return E.ItemData.LoadSynchronous();
+		return InventorySyncLoad::Load(E.ItemData, TEXT("Equipment.ResolveData"));
 	return nullptr;
 }
 
 void UEquipmentComponent::OnRep_Equipped()
 {
+	RefreshResidencyPins();
+
 	for (const FEquippedEntry& E : Equipped)
 	{
 		if (UItemDataAsset* Data = ResolveData(E))
@@ -248,18 +270,42 @@ bool UEquipmentComponent::Equip_Internal(const FGameplayTag& SlotTag, UInventory
 	if (Item.ItemData.IsNull())
 		return false;
 
-	UItemDataAsset* Data = Item.ItemData.LoadSynchronous();
-	if (!Data) return false;
+	if (UItemDataAsset* Resident = Item.GetResidentItemData())
+	{
+		return FinishEquip(SlotTag, SourceInventory, SourceIndex, Resident);
+	}
+
+	// Not resident: stream it in, then re-check the slot still holds the same item before equipping.
+	TWeakObjectPtr<UInventoryComponent> WeakInv = SourceInventory;
+	const FSoftObjectPath Expected = Item.ItemData.ToSoftObjectPath();
+	Item.RequestItemData(FItemDataResolvedDelegate::CreateWeakLambda(this, [this, SlotTag, WeakInv, SourceIndex, Expected](UItemDataAsset* Data)
+	{
+		UInventoryComponent* Inv = WeakInv.Get();
+		if (!Data || !Inv) return;
+		if (Inv->GetItem(SourceIndex).ItemData.ToSoftObjectPath() != Expected) return;
+
+		FinishEquip(SlotTag, Inv, SourceIndex, Data);
+	}));
+	return true;
+}
+
+bool UEquipmentComponent::FinishEquip(const FGameplayTag& SlotTag, UInventoryComponent* SourceInventory, int32 SourceIndex, UItemDataAsset* Data)
+{
+	const FInventoryItem Item = SourceInventory->GetItem(SourceIndex);
 
 	// Enforce optional slot filter
 	if (!ValidateItemForSlot(SlotTag, Data))
 		return false;
 
+	// Take the item first: a reserved stack refuses the withdrawal, and equipping anyway would duplicate it.
+	if (!SourceInventory->TryRemoveItem(SourceIndex, 1))
+		return false;
+
 	FEquippedEntry* Entry = FindOrAddEntry(SlotTag);
 	Entry->ItemData = Item.ItemData;
 	Entry->ItemIDTag = Data->ItemIDTag;
 
-	SourceInventory->TryRemoveItem(SourceIndex, 1);
+	RefreshResidencyPins();
 
 	OnEquipmentChanged.Broadcast(SlotTag, Data);
 	OnEquippedItemChanged.Broadcast(SlotTag, Data);
@@ -272,6 +318,7 @@ bool UEquipmentComponent::Unequip_Internal(const FGameplayTag& SlotTag, UInvento
 	if (!E) return false;
 
 	RemoveEntry(SlotTag);
+	RefreshResidencyPins();
 
 	OnEquipmentSlotCleared.Broadcast(SlotTag);
 	OnEquippedSlotCleared.Broadcast(SlotTag);
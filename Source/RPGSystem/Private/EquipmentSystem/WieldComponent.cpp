@@ -7,6 +7,8 @@
 #include "Inventory/ItemDataAsset.h"
 #include "Inventory/WeaponItemDataAsset.h"
 #include "Inventory/InventoryHelpers.h"
+#include "Inventory/InventoryAssetManager.h"
+#include "Inventory/SyncLoadStats.h"
 #include "Net/UnrealNetwork.h"
 #include "AbilitySystemInterface.h"
 
@@ -54,18 +56,43 @@ UDynamicToolbarComponent* UWieldComponent::ResolveToolbar() const
 
 UItemDataAsset* UWieldComponent::LoadByItemTag(const FGameplayTag& ItemID) const
 {
-	return UInventoryHelpers::FindItemDataByTag(GetOwner(), ItemID);
+	return UInventoryHelpers::FindItemDataByTag(GetOwner(), ItemID, /*bSyncLoad=*/false);
 }
 
 UItemDataAsset* UWieldComponent::GetCurrentWieldedItemData() const
 {
 	if (!WieldedItemIDTag.IsValid()) return nullptr;
+	if (WieldedItemData && WieldedItemData->ItemIDTag == WieldedItemIDTag) return WieldedItemData;
 	return LoadByItemTag(WieldedItemIDTag);
 }
 
 void UWieldComponent::OnRep_WieldedItem()
 {
-	OnWieldedItemChanged.Broadcast(WieldedItemIDTag, GetCurrentWieldedItemData());
+	UItemDataAsset* Data = GetCurrentWieldedItemData();
+	WieldedItemData = Data;
+	OnWieldedItemChanged.Broadcast(WieldedItemIDTag, Data);
+
+	if (!Data && WieldedItemIDTag.IsValid())
+	{
+		ResolveWieldedItemAsync();
+	}
+}
+
+void UWieldComponent::ResolveWieldedItemAsync()
+{
+	UInventoryAssetManager* AM = UInventoryAssetManager::GetOptional();
+	if (!AM) return;
+
+	const FGameplayTag Requested = WieldedItemIDTag;
+	WieldedItemLoad = AM->RequestItemDataByTag(Requested, FItemDataResolvedDelegate::CreateWeakLambda(this, [this, Requested](UItemDataAsset* Data)
+	{
+		// Stale if another item was wielded while this one streamed in.
+		if (!Data || WieldedItemIDTag != Requested) return;
+
+		WieldedItemData = Data;
+		OnWieldedItemChanged.Broadcast(WieldedItemIDTag, Data);
+		OnPoseTagChanged.Broadcast(ResolvePoseTag(Data));
+	}));
 }
 void UWieldComponent::OnRep_Holstered()
 {
@@ -254,6 +281,7 @@ void UWieldComponent::WieldEquippedInSlot_Server(FGameplayTag SlotTag)
 		{
 			WieldSourceSlotTag = SlotTag;
 			WieldedItemIDTag   = D->ItemIDTag;
+			WieldedItemData    = D;
 			OnWieldedItemChanged.Broadcast(WieldedItemIDTag, D);
 
 			if (bForceWeaponsInCombat || bIsHolstered)
@@ -265,6 +293,7 @@ void UWieldComponent::WieldEquippedInSlot_Server(FGameplayTag SlotTag)
 	}
 	WieldSourceSlotTag = FGameplayTag();
 	WieldedItemIDTag   = FGameplayTag();
+	WieldedItemData    = nullptr;
 	OnWieldedItemChanged.Broadcast(WieldedItemIDTag, nullptr);
 }
 
@@ -327,7 +356,7 @@ void UWieldComponent::ApplyAbilitySetForItem(UItemDataAsset* ItemData, bool bGiv
 	const TSoftObjectPtr<UGSCAbilitySet>* Found = AbilitySetByItemID.Find(ItemID);
 	if (!Found || Found->IsNull()) return;
 
-	UGSCAbilitySet* Set = Found->LoadSynchronous();
+	UGSCAbilitySet* Set = InventorySyncLoad::Load(*Found, TEXT("Wield.ApplyAbilitySetForItem"));
 	if (!Set) return;
 
 	if (bGive)
@@ -2,20 +2,33 @@
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/ItemDataAsset.h"
 #include "Inventory/InventoryHelpers.h"
+#include "Inventory/SyncLoadStats.h"
+#include "Crafting/CraftingStationComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 
 UFuelComponent::UFuelComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
 }
 
 void UFuelComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (HasAuth())
+	{
+		BindFuelInventory(true);
+		RebuildFuelQueue();
+	}
 }
 
 void UFuelComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	BindFuelInventory(false);
+
 	if (UWorld* W = GetWorld())
 	{
 		W->GetTimerManager().ClearTimer(BurnFuelTimer);
@@ -23,6 +36,14 @@ void UFuelComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
+void UFuelComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UFuelComponent, bIsBurning);
+	DOREPLIFETIME(UFuelComponent, BurnWindow);
+}
+
 void UFuelComponent::StartBurn()
 {
 	if (!HasAuth() || bIsBurning || !FuelInventory) return;
@@ -30,17 +51,17 @@ void UFuelComponent::StartBurn()
 
 	bIsBurning = true;
 	TryStartNextFuel();
-	OnBurnStarted.Broadcast();
+	if (bIsBurning)
+	{
+		OnBurnStarted.Broadcast();
+	}
 }
 
 void UFuelComponent::StopBurn()
 {
 	if (!HasAuth()) return;
 
-	if (UWorld* W = GetWorld())
-	{
-		W->GetTimerManager().ClearTimer(BurnFuelTimer);
-	}
+	ClearBurnWindow();
 	bIsBurning = false;
 	OnBurnStopped.Broadcast();
 	NotifyFuelStateChanged();
@@ -48,24 +69,100 @@ void UFuelComponent::StopBurn()
 
 void UFuelComponent::PauseBurn()
 {
-	if (!HasAuth()) return;
+	if (!HasAuth() || !bIsBurning || !BurnWindow.IsRunning()) return;
+
+	// Freeze the unburnt part of the unit; the window is re-projected on resume.
+	const float Now = GetServerTimeSeconds();
+	BurnWindow.RemainingFuelSeconds = FMath::Max(0.f, (BurnWindow.EndServerTime - Now) * BurnWindow.SpeedMultiplier);
+	BurnWindow.EndServerTime = -1.f;
+	RemainingBurnTime = BurnWindow.RemainingFuelSeconds / BurnWindow.SpeedMultiplier;
+
 	if (UWorld* W = GetWorld())
 	{
-		W->GetTimerManager().PauseTimer(BurnFuelTimer);
+		W->GetTimerManager().ClearTimer(BurnFuelTimer);
 	}
+	NotifyFuelStateChanged();
 }
 
 void UFuelComponent::ResumeBurn()
 {
-	if (!HasAuth()) return;
-	if (UWorld* W = GetWorld())
+	if (!HasAuth() || !bIsBurning || BurnWindow.IsRunning()) return;
+	ScheduleBurnWindow(GetServerTimeSeconds());
+}
+
+void UFuelComponent::SetBurnSpeedMultiplier(float NewMultiplier)
+{
+	BurnSpeedMultiplier = NewMultiplier;
+	if (!HasAuth() || !bIsBurning) return;
+
+	const float Now = GetServerTimeSeconds();
+	if (BurnWindow.IsRunning())
+	{
+		BurnWindow.RemainingFuelSeconds = FMath::Max(0.f, (BurnWindow.EndServerTime - Now) * BurnWindow.SpeedMultiplier);
+	}
+	BurnWindow.SpeedMultiplier = FMath::Max(0.01f, BurnSpeedMultiplier);
+
+	if (BurnWindow.IsRunning())
+	{
+		ScheduleBurnWindow(Now);
+	}
+}
+
+float UFuelComponent::GetRemainingBurnSeconds() const
+{
+	if (!bIsBurning) return 0.f;
+	if (!BurnWindow.IsRunning())
 	{
-		W->GetTimerManager().UnPauseTimer(BurnFuelTimer);
+		return BurnWindow.RemainingFuelSeconds / FMath::Max(0.01f, BurnWindow.SpeedMultiplier);
 	}
+	return FMath::Max(0.f, BurnWindow.EndServerTime - GetServerTimeSeconds());
+}
+
+float UFuelComponent::GetAvailableBurnSeconds() const
+{
+	float FuelSeconds = 0.f;
+	for (const FFuelQueueEntry& E : FuelQueue)
+	{
+		FuelSeconds += E.BurnSeconds * E.Quantity;
+	}
+
+	if (!bIsBurning)
+	{
+		return FuelSeconds / FMath::Max(0.01f, BurnSpeedMultiplier);
+	}
+
+	// The burning unit stays in the inventory until it completes; count only its unburnt part.
+	FuelSeconds = FMath::Max(0.f, FuelSeconds - BurnWindow.FuelSeconds);
+	return GetRemainingBurnSeconds() + FuelSeconds / FMath::Max(0.01f, BurnWindow.SpeedMultiplier);
+}
+
+float UFuelComponent::GetBurnProgress() const
+{
+	const float Total = BurnWindow.FuelSeconds / FMath::Max(0.01f, BurnWindow.SpeedMultiplier);
+	if (!bIsBurning || Total <= 0.f) return 0.f;
+	return FMath::Clamp(1.f - GetRemainingBurnSeconds() / Total, 0.f, 1.f);
+}
+
+void UFuelComponent::SetFuelInventory(UInventoryComponent* NewFuelInventory)
+{
+	if (NewFuelInventory == FuelInventory) return;
+
+	BindFuelInventory(false);
+	FuelInventory = NewFuelInventory;
+	BindFuelInventory(true);
+	RebuildFuelQueue();
+}
+
+void UFuelComponent::SetSelectionPolicy(EFuelSelectionPolicy NewPolicy)
+{
+	SelectionPolicy = NewPolicy;
+	SortFuelQueue();
 }
 
 bool UFuelComponent::HasFuel() const
 {
+	if (HasAuth()) return FuelQueue.Num() > 0;
+
 	if (!FuelInventory) return false;
 	for (const auto& Slot : FuelInventory->GetItems())
 	{
@@ -85,137 +182,422 @@ void UFuelComponent::TryStartNextFuel()
 {
 	if (!HasAuth() || !FuelInventory) return;
 
-	const TArray<FInventoryItem>& Items = FuelInventory->GetItems();
-	for (int32 i = 0; i < Items.Num(); ++i)
+	if (FuelQueue.Num() > 0)
 	{
-		const FInventoryItem& FuelItem = Items[i];
-		if (!FuelItem.IsValid()) continue;
+		const FFuelQueueEntry& Next = FuelQueue[0];
+		BurningSlot = Next.SlotIndex;
+		BeginBurnWindow(Next.BurnSeconds);
+		return;
+	}
 
-		if (UItemDataAsset* BurnedFuel = FuelItem.ResolveItemData())
-		{
-			const float FuelBurnTime = BurnedFuel->GetTotalBurnSeconds();
-			TotalBurnTime     = FuelBurnTime / FMath::Max(0.01f, BurnSpeedMultiplier);
-			RemainingBurnTime = TotalBurnTime;
+	DoAutoStop();
+}
 
-			if (UWorld* W = GetWorld())
-			{
-				W->GetTimerManager().SetTimer(BurnFuelTimer, this, &UFuelComponent::BurnTimerTick, 1.0f, true);
-			}
-			NotifyFuelStateChanged();
-			return;
-		}
+void UFuelComponent::BeginBurnWindow(float FuelSeconds)
+{
+	BurnWindow.FuelSeconds          = FMath::Max(0.f, FuelSeconds);
+	BurnWindow.RemainingFuelSeconds = BurnWindow.FuelSeconds;
+	BurnWindow.SpeedMultiplier      = FMath::Max(0.01f, BurnSpeedMultiplier);
+	ScheduleBurnWindow(GetServerTimeSeconds());
+}
+
+void UFuelComponent::ScheduleBurnWindow(float Now)
+{
+	// Speed is applied exactly once: fuel-seconds / speed = wall seconds.
+	const float Speed = BurnWindow.SpeedMultiplier;
+	BurnWindow.EndServerTime   = Now + BurnWindow.RemainingFuelSeconds / Speed;
+	BurnWindow.StartServerTime = BurnWindow.EndServerTime - BurnWindow.FuelSeconds / Speed;
+
+	TotalBurnTime     = BurnWindow.FuelSeconds / Speed;
+	RemainingBurnTime = BurnWindow.EndServerTime - Now;
+
+	if (UWorld* W = GetWorld())
+	{
+		// SetTimer treats <= 0 as "clear"; zero-length fuel completes on the next tick.
+		W->GetTimerManager().SetTimer(BurnFuelTimer, this, &UFuelComponent::BurnUnitComplete, FMath::Max(0.001f, RemainingBurnTime), false);
 	}
+	NotifyFuelStateChanged();
+}
 
+void UFuelComponent::ClearBurnWindow()
+{
+	if (UWorld* W = GetWorld())
+	{
+		W->GetTimerManager().ClearTimer(BurnFuelTimer);
+	}
+	BurnWindow = FFuelBurnWindow();
 	TotalBurnTime = 0.0f;
 	RemainingBurnTime = 0.0f;
+}
 
-	if (UWorld* W = GetWorld())
+void UFuelComponent::BurnUnitComplete()
+{
+	if (!HasAuth()) return;
+
+	BurnFuelOnce();
+	OnFuelDepleted.Broadcast();
+
+	if (ShouldKeepBurning())
 	{
-		W->GetTimerManager().ClearTimer(BurnFuelTimer);
+		TryStartNextFuel();
 	}
-	DoAutoStop();
+	else
+	{
+		DoAutoStop();
+	}
+}
+
+void UFuelComponent::BurnFuelOnce()
+{
+	if (!HasAuth() || !FuelInventory || FuelQueue.Num() == 0) return;
+
+	// Burn from the stack the unit was started from, unless it has since been moved out.
+	const bool bStillThere = FuelQueue.ContainsByPredicate([this](const FFuelQueueEntry& E) { return E.SlotIndex == BurningSlot; });
+	const int32 Slot = bStillThere ? BurningSlot : FuelQueue[0].SlotIndex;
+	BurningSlot = INDEX_NONE;
+
+	TMap<UItemDataAsset*, int32> Byproducts;
+	BurnUnits(Slot, 1, Byproducts);
+	GrantByproducts(Byproducts);
 }
 
-void UFuelComponent::BurnTimerTick()
+void UFuelComponent::BurnUnits(int32 SlotIndex, int32 Units, TMap<UItemDataAsset*, int32>& InOutByproducts)
 {
-	if (!HasAuth())
+	const FFuelQueueEntry* Entry = FuelQueue.FindByPredicate([SlotIndex](const FFuelQueueEntry& E) { return E.SlotIndex == SlotIndex; });
+	if (!Entry || Units <= 0) return;
+
+	// Copy out before removing: the removal delta rewrites FuelQueue.
+	TArray<FFuelByproductHandle> ByHandles;
+	if (const FFuelDefinition* Def = FuelDefinitions.Find(Entry->Item))
+	{
+		ByHandles = Def->Byproducts;
+	}
+
+	if (FuelInventory->TryRemoveItem(SlotIndex, Units))
 	{
-		if (UWorld* W = GetWorld())
+		for (const FFuelByproductHandle& By : ByHandles)
 		{
-			W->GetTimerManager().ClearTimer(BurnFuelTimer);
+			InOutByproducts.FindOrAdd(By.Item) += By.Amount * Units;
 		}
-		return;
+		LastBurnTime = GetWorld()->GetTimeSeconds();
 	}
+}
 
-	if (RemainingBurnTime > 0.0f)
-	{
-		const float Delta = 1.0f * BurnSpeedMultiplier;
-		RemainingBurnTime = FMath::Max(0.0f, RemainingBurnTime - Delta);
-		OnFuelBurnProgress.Broadcast(RemainingBurnTime);
+void UFuelComponent::GrantByproducts(const TMap<UItemDataAsset*, int32>& Byproducts)
+{
+	if (!ByproductInventory) return;
 
-		if (RemainingBurnTime <= 0.0f)
+	for (const TPair<UItemDataAsset*, int32>& By : Byproducts)
+	{
+		if (By.Key && By.Value > 0)
 		{
-			if (UWorld* W = GetWorld())
-			{
-				W->GetTimerManager().ClearTimer(BurnFuelTimer);
-			}
+			ByproductInventory->TryAddItem(By.Key, By.Value);
+		}
+	}
+}
 
-			BurnFuelOnce();
-			OnFuelDepleted.Broadcast();
+int32 UFuelComponent::CatchUpBurn(float ElapsedSeconds)
+{
+	if (!HasAuth() || !bIsBurning || !BurnWindow.IsRunning() || ElapsedSeconds <= 0.f) return 0;
 
-			if (ShouldKeepBurning())
-			{
-				TryStartNextFuel();
-			}
-			else
-			{
-				DoAutoStop();
-			}
-		}
+	// Works in fuel-seconds and assumes the station stayed active for the whole span.
+	const float Now = GetServerTimeSeconds();
+	float Budget = ElapsedSeconds * BurnWindow.SpeedMultiplier;
+	const float CurrentLeft = FMath::Max(0.f, (BurnWindow.EndServerTime - Now) * BurnWindow.SpeedMultiplier);
+
+	if (Budget < CurrentLeft)
+	{
+		BurnWindow.RemainingFuelSeconds = CurrentLeft - Budget;
+		ScheduleBurnWindow(Now);
+		return 0;
 	}
-	else
+	Budget -= CurrentLeft;
+
+	// Plan on a copy of the queue (policy order), then apply one removal per stack.
+	TArray<FFuelQueueEntry> Plan = FuelQueue;
+	TMap<int32, int32> UnitsBySlot;
+	if (Plan.Num() == 0)
+	{
+		DoAutoStop();
+		return 0;
+	}
+
+	const int32 CurrentIdx = Plan.IndexOfByPredicate([this](const FFuelQueueEntry& E) { return E.SlotIndex == BurningSlot; });
+	FFuelQueueEntry& Current = Plan[CurrentIdx != INDEX_NONE ? CurrentIdx : 0];
+	--Current.Quantity;
+	UnitsBySlot.FindOrAdd(Current.SlotIndex) += 1;
+
+	const FFuelQueueEntry* Partial = nullptr;
+	for (FFuelQueueEntry& E : Plan)
 	{
-		if (UWorld* W = GetWorld())
+		if (E.Quantity <= 0) continue;
+
+		const int32 Units = E.BurnSeconds > 0.f
+			? FMath::Min(E.Quantity, FMath::FloorToInt(Budget / E.BurnSeconds))
+			: E.Quantity;
+
+		if (Units > 0)
+		{
+			Budget -= Units * E.BurnSeconds;
+			E.Quantity -= Units;
+			UnitsBySlot.FindOrAdd(E.SlotIndex) += Units;
+		}
+		if (E.Quantity > 0)
 		{
-			W->GetTimerManager().ClearTimer(BurnFuelTimer);
+			Partial = &E;
+			break;
 		}
+	}
+
+	int32 Consumed = 0;
+	TMap<UItemDataAsset*, int32> Byproducts;
+	for (const TPair<int32, int32>& It : UnitsBySlot)
+	{
+		BurnUnits(It.Key, It.Value, Byproducts);
+		Consumed += It.Value;
+	}
+	GrantByproducts(Byproducts);
+	OnFuelDepleted.Broadcast();
+
+	if (!Partial)
+	{
 		DoAutoStop();
+		return Consumed;
 	}
+
+	// Leave the next unit running with the leftover budget already burnt.
+	BurningSlot = Partial->SlotIndex;
+	BurnWindow.FuelSeconds          = Partial->BurnSeconds;
+	BurnWindow.RemainingFuelSeconds = FMath::Max(0.f, Partial->BurnSeconds - Budget);
+	BurnWindow.SpeedMultiplier      = FMath::Max(0.01f, BurnSpeedMultiplier);
+	ScheduleBurnWindow(Now);
+	return Consumed;
 }
 
-void UFuelComponent::BurnFuelOnce()
+// --- Fuel queue ---
+void UFuelComponent::BindFuelInventory(bool bBind)
 {
 	if (!HasAuth() || !FuelInventory) return;
 
-	const TArray<FInventoryItem>& Items = FuelInventory->GetItems();
-	for (int32 i = 0; i < Items.Num(); ++i)
+	if (bBind)
+	{
+		FuelInventory->OnInventoryDelta.AddUObject(this, &UFuelComponent::HandleFuelInventoryDelta);
+	}
+	else
 	{
-		const FInventoryItem& FuelItem = Items[i];
-		if (!FuelItem.IsValid()) continue;
+		FuelInventory->OnInventoryDelta.RemoveAll(this);
+	}
+}
 
-		UItemDataAsset* BurnedFuel = FuelItem.ResolveItemData();
-		if (FuelInventory->TryRemoveItem(i, 1))
+void UFuelComponent::HandleFuelInventoryDelta(UInventoryComponent* Changed, const FInventoryDelta& Delta)
+{
+	if (Changed != FuelInventory) return;
+
+	if (Delta.bFullRefresh)
+	{
+		RebuildFuelQueue();
+	}
+	else
+	{
+		if (Delta.Moves.Num() > 0)
 		{
-			if (ByproductInventory && BurnedFuel)
+			TMap<int32, int32> FromTo;
+			for (const TPair<int32, int32>& Move : Delta.Moves) FromTo.Add(Move.Key, Move.Value);
+
+			for (FFuelQueueEntry& E : FuelQueue)
 			{
-				for (const auto& By : BurnedFuel->FuelByproducts)
-				{
-					if (By.ByproductItemID.IsValid() && By.Amount > 0)
-					{
-						UItemDataAsset* ByAsset = nullptr;
-						if (bResolveByproductByTag)
-						{
-							ByAsset = UInventoryHelpers::FindItemDataByTag(this, By.ByproductItemID);
-						}
-						if (ByAsset)
-						{
-							ByproductInventory->TryAddItem(ByAsset, By.Amount);
-						}
-					}
-				}
+				if (const int32* To = FromTo.Find(E.SlotIndex)) E.SlotIndex = *To;
 			}
-			LastBurnTime = GetWorld()->GetTimeSeconds();
+			if (const int32* To = FromTo.Find(BurningSlot)) BurningSlot = *To;
+		}
+
+		for (const int32 SlotIndex : Delta.ChangedSlots)
+		{
+			RefreshQueueSlot(SlotIndex);
 		}
+		SortFuelQueue();
+	}
+
+	// Refilled while a linked job is starved: relight, which resumes the job through OnFuelActiveChanged.
+	if (!bIsBurning && FuelQueue.Num() > 0 && LinkedStation.IsValid() && IsCraftingActive())
+	{
+		StartBurn();
+	}
+}
+
+void UFuelComponent::RebuildFuelQueue()
+{
+	FuelQueue.Reset();
+	if (!HasAuth() || !FuelInventory) return;
+
+	const int32 NumSlots = FuelInventory->GetItems().Num();
+	for (int32 i = 0; i < NumSlots; ++i)
+	{
+		RefreshQueueSlot(i);
+	}
+	SortFuelQueue();
+}
+
+void UFuelComponent::RefreshQueueSlot(int32 SlotIndex)
+{
+	FuelQueue.RemoveAll([SlotIndex](const FFuelQueueEntry& E) { return E.SlotIndex == SlotIndex; });
+	if (!FuelInventory) return;
+
+	const FInventoryItem Item = FuelInventory->GetItem(SlotIndex);
+	if (!Item.IsValid()) return;
+
+	// Loaded assets are reused; only a stack that was never loaded pays for a resolve.
+	UItemDataAsset* Asset = Item.ItemData.Get();
+	if (!Asset)
+	{
+		InventorySyncLoad::FCallSite Site(TEXT("Fuel.RefreshQueueSlot"));
+		Asset = Item.ResolveItemData();
+	}
+
+	if (const FFuelDefinition* Def = ResolveFuelDefinition(Asset))
+	{
+		FFuelQueueEntry& E = FuelQueue.AddDefaulted_GetRef();
+		E.SlotIndex   = SlotIndex;
+		E.Item        = Asset;
+		E.Quantity    = Item.Quantity;
+		E.BurnSeconds = Def->BurnSeconds;
+	}
+}
+
+void UFuelComponent::SortFuelQueue()
+{
+	switch (SelectionPolicy)
+	{
+	case EFuelSelectionPolicy::LongestBurn:
+		FuelQueue.Sort([](const FFuelQueueEntry& A, const FFuelQueueEntry& B)
+		{
+			return A.BurnSeconds != B.BurnSeconds ? A.BurnSeconds > B.BurnSeconds : A.SlotIndex < B.SlotIndex;
+		});
+		break;
+	case EFuelSelectionPolicy::ShortestBurn:
+		FuelQueue.Sort([](const FFuelQueueEntry& A, const FFuelQueueEntry& B)
+		{
+			return A.BurnSeconds != B.BurnSeconds ? A.BurnSeconds < B.BurnSeconds : A.SlotIndex < B.SlotIndex;
+		});
+		break;
+	default:
+		FuelQueue.Sort([](const FFuelQueueEntry& A, const FFuelQueueEntry& B) { return A.SlotIndex < B.SlotIndex; });
 		break;
 	}
 }
 
+const FFuelDefinition* UFuelComponent::ResolveFuelDefinition(UItemDataAsset* Asset)
+{
+	if (!Asset || !Asset->bIsFuel) return nullptr;
+
+	if (const FFuelDefinition* Found = FuelDefinitions.Find(Asset))
+	{
+		return Found;
+	}
+
+	FFuelDefinition& Def = FuelDefinitions.Add(Asset);
+	Def.BurnSeconds = Asset->GetTotalBurnSeconds();
+
+	for (const FFuelByproduct& By : Asset->FuelByproducts)
+	{
+		if (!By.ByproductItemID.IsValid() || By.Amount <= 0 || !bResolveByproductByTag) continue;
+
+		InventorySyncLoad::FCallSite Site(TEXT("Fuel.ResolveFuelDefinition"));
+		if (UItemDataAsset* ByAsset = UInventoryHelpers::FindItemDataByTag(this, By.ByproductItemID))
+		{
+			FFuelByproductHandle& Handle = Def.Byproducts.AddDefaulted_GetRef();
+			Handle.Item   = ByAsset;
+			Handle.Amount = By.Amount;
+		}
+	}
+	return &Def;
+}
+
 void UFuelComponent::NotifyFuelStateChanged()
 {
+	// State changes only: clients extrapolate progress from BurnWindow between them.
+	OnFuelBurnProgress.Broadcast(GetRemainingBurnSeconds());
+
+	const bool bActive = IsBurnActive();
+	if (bActive != bLastBurnActive)
+	{
+		bLastBurnActive = bActive;
+		OnFuelActiveChanged.Broadcast(bActive);
+	}
+
+	if (AActor* Owner = GetOwner())
+	{
+		Owner->ForceNetUpdate();
+	}
 }
 
 void UFuelComponent::OnCraftingActivated()
 {
+	if (!HasAuth()) return;
+
+	if (!bIsBurning)
+	{
+		StartBurn();
+	}
+	else if (!BurnWindow.IsRunning())
+	{
+		ResumeBurn();
+	}
+}
+
+void UFuelComponent::OnCraftingDeactivated()
+{
+	if (!HasAuth() || !bAutoStopBurnWhenIdle) return;
+
+	// Banked, not stopped: the partial unit resumes with the next job.
+	PauseBurn();
+}
+
+void UFuelComponent::SetLinkedStation(UCraftingStationComponent* Station)
+{
+	LinkedStation = Station;
+}
+
+bool UFuelComponent::IsCraftingActive() const
+{
+	const UCraftingStationComponent* Station = LinkedStation.Get();
+	// A dormant station accounts for its fuel in closed form; refills must not relight it.
+	return !Station || (Station->IsCraftingInProgress() && !Station->IsDormant());
 }
 
 void UFuelComponent::DoAutoStop()
 {
-	if (!bIsBurning)
+	const bool bWasBurning = bIsBurning;
+
+	ClearBurnWindow();
+	bIsBurning = false;
+
+	if (bWasBurning)
 	{
-		TotalBurnTime = 0.0f;
-		RemainingBurnTime = 0.0f;
 		OnBurnStopped.Broadcast();
 	}
-	bIsBurning = false;
 	NotifyFuelStateChanged();
 }
+
+float UFuelComponent::GetServerTimeSeconds() const
+{
+	const UWorld* W = GetWorld();
+	if (!W) return 0.f;
+	if (const AGameStateBase* GS = W->GetGameState())
+	{
+		return static_cast<float>(GS->GetServerWorldTimeSeconds());
+	}
+	return W->GetTimeSeconds();
+}
+
+// --- RepNotifies ---
+void UFuelComponent::OnRep_BurnWindow()
+{
+	OnFuelBurnProgress.Broadcast(GetRemainingBurnSeconds());
+}
+
+void UFuelComponent::OnRep_IsBurning()
+{
+	if (bIsBurning) OnBurnStarted.Broadcast();
+	else            OnBurnStopped.Broadcast();
+}
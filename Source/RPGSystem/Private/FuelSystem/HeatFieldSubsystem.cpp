@@ -0,0 +1,312 @@
+#include "FuelSystem/HeatFieldSubsystem.h"
+#include "DecaySystem/DecayComponent.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+namespace HeatField
+{
+	// XY cell edge in cm; about two campfire radii, so most fires touch 1-4 cells.
+	constexpr float CellSize = 1000.f;
+
+	// Seconds between batched pawn refreshes while any source burns.
+	constexpr float PawnRefreshInterval = 0.5f;
+
+	// Points per ParallelFor task in GetWarmthAtPoints.
+	constexpr int32 PointsPerTask = 256;
+}
+
+bool UHeatFieldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UHeatFieldSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PawnRefreshTimer);
+	}
+	Sources.Reset();
+	FreeSources.Reset();
+	Cells.Reset();
+	PawnSources.Reset();
+	NumActive = 0;
+	Super::Deinitialize();
+}
+
+bool UHeatFieldSubsystem::PushesEnvironment() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+// --- Sources ---
+int32 UHeatFieldSubsystem::RegisterSource(AActor* Source, float Radius, float Intensity, const FGameplayTagContainer& EnvironmentTags, bool bActive)
+{
+	if (!Source || Radius <= 0.f) return INDEX_NONE;
+
+	const int32 Handle = FreeSources.Num() > 0 ? FreeSources.Pop(EAllowShrinking::No) : Sources.AddDefaulted();
+
+	FHeatSource& S = Sources[Handle];
+	S = FHeatSource();
+	S.Actor           = Source;
+	S.Location        = Source->GetActorLocation();
+	S.Radius          = Radius;
+	S.Intensity       = Intensity;
+	S.EnvironmentTags = EnvironmentTags;
+	S.bInUse          = true;
+
+	LinkCells(Handle, true);
+	SetSourceActive(Handle, bActive);
+	return Handle;
+}
+
+void UHeatFieldSubsystem::UnregisterSource(int32 Handle)
+{
+	if (!Sources.IsValidIndex(Handle) || !Sources[Handle].bInUse) return;
+
+	SetSourceActive(Handle, false);
+	LinkCells(Handle, false);
+
+	Sources[Handle] = FHeatSource();
+	FreeSources.Add(Handle);
+}
+
+void UHeatFieldSubsystem::SetSourceActive(int32 Handle, bool bActive)
+{
+	if (!Sources.IsValidIndex(Handle)) return;
+
+	FHeatSource& S = Sources[Handle];
+	if (!S.bInUse || S.bActive == bActive) return;
+
+	S.bActive = bActive;
+	NumActive += bActive ? 1 : -1;
+
+	if (!bActive)
+	{
+		// Leave immediately; entering waits for the next batched refresh.
+		ExitSourceForAllPawns(Handle);
+	}
+	UpdatePawnRefreshTimer();
+}
+
+void UHeatFieldSubsystem::UpdateSource(int32 Handle, float Radius)
+{
+	if (!Sources.IsValidIndex(Handle) || !Sources[Handle].bInUse) return;
+
+	FHeatSource& S = Sources[Handle];
+	LinkCells(Handle, false);
+	if (const AActor* Actor = S.Actor.Get())
+	{
+		S.Location = Actor->GetActorLocation();
+	}
+	S.Radius = FMath::Max(0.f, Radius);
+	LinkCells(Handle, true);
+}
+
+// --- Grid ---
+FIntPoint UHeatFieldSubsystem::CellOf(const FVector& Point)
+{
+	return FIntPoint(FMath::FloorToInt(Point.X / HeatField::CellSize), FMath::FloorToInt(Point.Y / HeatField::CellSize));
+}
+
+void UHeatFieldSubsystem::LinkCells(int32 Handle, bool bLink)
+{
+	const FHeatSource& S = Sources[Handle];
+	const FIntPoint Min = CellOf(S.Location - FVector(S.Radius, S.Radius, 0.f));
+	const FIntPoint Max = CellOf(S.Location + FVector(S.Radius, S.Radius, 0.f));
+
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			const FIntPoint Cell(X, Y);
+			if (bLink)
+			{
+				Cells.FindOrAdd(Cell).Add(Handle);
+			}
+			else if (TArray<int32>* InCell = Cells.Find(Cell))
+			{
+				InCell->RemoveSingleSwap(Handle, EAllowShrinking::No);
+				if (InCell->Num() == 0) Cells.Remove(Cell);
+			}
+		}
+	}
+}
+
+template<typename FVisitor>
+void UHeatFieldSubsystem::ForEachSourceAt(const FVector& Point, FVisitor&& Visitor) const
+{
+	const TArray<int32>* InCell = Cells.Find(CellOf(Point));
+	if (!InCell) return;
+
+	for (const int32 Handle : *InCell)
+	{
+		const FHeatSource& S = Sources[Handle];
+		if (!S.bActive) continue;
+
+		const float DistSq = FVector::DistSquared(S.Location, Point);
+		if (DistSq > FMath::Square(S.Radius)) continue;
+
+		Visitor(Handle, S, 1.f - FMath::Sqrt(DistSq) / S.Radius);
+	}
+}
+
+// --- Queries ---
+float UHeatFieldSubsystem::GetWarmthAtPoint(const FVector& Point) const
+{
+	float Warmth = 0.f;
+	ForEachSourceAt(Point, [&Warmth](int32, const FHeatSource& S, float Falloff)
+	{
+		Warmth += S.Intensity * Falloff;
+	});
+	return Warmth;
+}
+
+void UHeatFieldSubsystem::GetSourcesAffectingPoint(const FVector& Point, TArray<AActor*>& OutSources) const
+{
+	OutSources.Reset();
+	ForEachSourceAt(Point, [&OutSources](int32, const FHeatSource& S, float)
+	{
+		if (AActor* Actor = S.Actor.Get()) OutSources.Add(Actor);
+	});
+}
+
+void UHeatFieldSubsystem::GetSourcesAffectingActor(const AActor* Target, TArray<AActor*>& OutSources) const
+{
+	OutSources.Reset();
+	if (Target)
+	{
+		GetSourcesAffectingPoint(Target->GetActorLocation(), OutSources);
+	}
+}
+
+void UHeatFieldSubsystem::GetWarmthAtPoints(TConstArrayView<FVector> Points, TArrayView<float> OutWarmth) const
+{
+	check(Points.Num() == OutWarmth.Num());
+
+	const int32 N = Points.Num();
+	const int32 NumTasks = FMath::DivideAndRoundUp(N, HeatField::PointsPerTask);
+
+	// Read-only over the grid, so chunks run in parallel without locking.
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		const int32 Begin = Task * HeatField::PointsPerTask;
+		const int32 End   = FMath::Min(Begin + HeatField::PointsPerTask, N);
+		for (int32 i = Begin; i < End; ++i)
+		{
+			OutWarmth[i] = GetWarmthAtPoint(Points[i]);
+		}
+	}, NumTasks <= 1);
+}
+
+void UHeatFieldSubsystem::GetPlayerPawnWarmth(TArray<APawn*>& OutPawns, TArray<float>& OutWarmth) const
+{
+	OutPawns.Reset();
+	OutWarmth.Reset();
+
+	const UWorld* World = GetWorld();
+	if (!World) return;
+
+	TArray<FVector> Points;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (APawn* Pawn = PC ? PC->GetPawn() : nullptr)
+		{
+			OutPawns.Add(Pawn);
+			Points.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	OutWarmth.SetNumZeroed(Points.Num());
+	if (NumActive > 0)
+	{
+		GetWarmthAtPoints(Points, OutWarmth);
+	}
+}
+
+// --- Pawn environment ---
+void UHeatFieldSubsystem::UpdatePawnRefreshTimer()
+{
+	UWorld* World = GetWorld();
+	if (!World || !PushesEnvironment()) return;
+
+	FTimerManager& Timers = World->GetTimerManager();
+	if (NumActive > 0)
+	{
+		if (!Timers.IsTimerActive(PawnRefreshTimer))
+		{
+			Timers.SetTimer(PawnRefreshTimer, this, &UHeatFieldSubsystem::RefreshPlayerPawns, HeatField::PawnRefreshInterval, true);
+		}
+	}
+	else
+	{
+		Timers.ClearTimer(PawnRefreshTimer);
+	}
+}
+
+void UHeatFieldSubsystem::RefreshPlayerPawns()
+{
+	const UWorld* World = GetWorld();
+	if (!World) return;
+
+	// Drop pawns that despawned; their decay components went with them.
+	for (auto It = PawnSources.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid()) It.RemoveCurrent();
+	}
+
+	TArray<int32> Inside;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		if (!Pawn) continue;
+
+		Inside.Reset();
+		ForEachSourceAt(Pawn->GetActorLocation(), [&Inside](int32 Handle, const FHeatSource&, float)
+		{
+			Inside.Add(Handle);
+		});
+		Inside.Sort();
+
+		TArray<int32>& Was = PawnSources.FindOrAdd(Pawn);
+		if (Inside == Was) continue;
+
+		for (const int32 Handle : Was)
+		{
+			if (!Inside.Contains(Handle))
+			{
+				UDecayComponent::NotifyEnvironmentExited(Pawn, Sources[Handle].Actor.Get());
+			}
+		}
+		for (const int32 Handle : Inside)
+		{
+			if (!Was.Contains(Handle))
+			{
+				UDecayComponent::NotifyEnvironmentEntered(Pawn, Sources[Handle].Actor.Get(), Sources[Handle].EnvironmentTags);
+			}
+		}
+		Was = Inside;
+	}
+}
+
+void UHeatFieldSubsystem::ExitSourceForAllPawns(int32 Handle)
+{
+	UObject* SourceActor = Sources[Handle].Actor.Get();
+
+	for (TPair<TWeakObjectPtr<APawn>, TArray<int32>>& It : PawnSources)
+	{
+		if (It.Value.Remove(Handle) == 0) continue;
+
+		if (APawn* Pawn = It.Key.Get())
+		{
+			UDecayComponent::NotifyEnvironmentExited(Pawn, SourceActor);
+		}
+	}
+}
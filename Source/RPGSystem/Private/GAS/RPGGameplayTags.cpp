@@ -0,0 +1,80 @@
+// GAS/RPGGameplayTags.cpp
+#include "GAS/RPGGameplayTags.h"
+
+#include "GameplayTagsSettings.h"
+#include "HAL/IConsoleManager.h"
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Access_Public,   "Inventory.Access.Public");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Access_ViewOnly, "Inventory.Access.ViewOnly");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Access_Private,  "Inventory.Access.Private");
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Type_PlayerBag,   "Inventory.Type.PlayerBag");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Type_Storage,     "Inventory.Type.Storage");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Type_CoolStorage, "Inventory.Type.CoolStorage");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Type_ColdStorage, "Inventory.Type.ColdStorage");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Type_StoreHouse,  "Inventory.Type.StoreHouse");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Inventory_Type_Compost,     "Inventory.Type.Compost");
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_Zone_Climate_Cold, "Zone.Climate.Cold");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Zone_Climate_Warm, "Zone.Climate.Warm");
+
+namespace RPGGameplayTags
+{
+	static const FNativeGameplayTag* const All[] =
+	{
+		&TAG_Inventory_Access_Public,
+		&TAG_Inventory_Access_ViewOnly,
+		&TAG_Inventory_Access_Private,
+
+		&TAG_Inventory_Type_PlayerBag,
+		&TAG_Inventory_Type_Storage,
+		&TAG_Inventory_Type_CoolStorage,
+		&TAG_Inventory_Type_ColdStorage,
+		&TAG_Inventory_Type_StoreHouse,
+		&TAG_Inventory_Type_Compost,
+
+		&TAG_Zone_Climate_Cold,
+		&TAG_Zone_Climate_Warm,
+
+		&TAG_Data_XP,
+		&TAG_Data_XP_Increment,
+		&TAG_Data_XP_CarryRemainder,
+		&TAG_Data_XPDelta,
+	};
+
+	TConstArrayView<const FNativeGameplayTag*> GetAll()
+	{
+		return All;
+	}
+
+	int32 ReportMissingFromConfig()
+	{
+		// Native tags register themselves, so the tag manager alone can't tell what the ini lacks.
+		TSet<FName> Configured;
+		for (const FGameplayTagTableRow& Row : GetDefault<UGameplayTagsSettings>()->GameplayTagList)
+		{
+			Configured.Add(Row.Tag);
+		}
+
+		int32 Missing = 0;
+		for (const FNativeGameplayTag* Native : All)
+		{
+			const FName TagName = Native->GetTag().GetTagName();
+			if (Configured.Contains(TagName)) continue;
+
+			UE_LOG(LogTemp, Warning, TEXT("[Tags] %s is used by C++ but missing from DefaultGameplayTags.ini"), *TagName.ToString());
+			++Missing;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[Tags] %d native tags, %d missing from DefaultGameplayTags.ini"), UE_ARRAY_COUNT(All), Missing);
+		return Missing;
+	}
+}
+
+static FAutoConsoleCommand GReportNativeTagsCmd(
+	TEXT("Tags.ReportMissing"),
+	TEXT("Tags.ReportMissing - log the module's native tags that are missing from DefaultGameplayTags.ini."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		RPGGameplayTags::ReportMissingFromConfig();
+	}));
@@ -2,15 +2,28 @@
 
 #include "Inventory/InventoryAssetManager.h"
 #include "Inventory/ItemDataAsset.h"
+#include "Inventory/ItemResidencySubsystem.h"
+#include "Inventory/SyncLoadStats.h"
+#include "GAS/RPGGameplayTags.h"
 
 #include "Engine/StreamableManager.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Ticker.h"
+#include "Hash/CityHash.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProperties.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "UObject/SoftObjectPath.h"
 #include "UObject/UObjectGlobals.h"
 
 // Optional headers for concrete asset classes we want to auto-register
 #include "Crafting/CraftingRecipeDataAsset.h"
+#include "Crafting/RecipeCatalogSubsystem.h"
 #include "Progression/XPGrantBundle.h"
 
 #define LOCTEXT_NAMESPACE "UInventoryAssetManager"
@@ -22,6 +35,65 @@ static IAssetRegistry& GetAR()
 	return ARM.Get();
 }
 
+namespace InventoryTagIndex
+{
+	constexpr uint32 Magic   = 0x58495449; // "ITIX"
+	constexpr uint32 Version = 3;
+
+	static uint64 HashString(const FString& S)
+	{
+		return CityHash64(reinterpret_cast<const char*>(*S), S.Len() * sizeof(TCHAR));
+	}
+
+	// Searchable FGameplayTag properties export either as the bare name or as (TagName="A.B").
+	static FName ParseTagName(const FString& Value)
+	{
+		FStringView View(Value);
+		View.TrimStartAndEndInline();
+
+		if (View.StartsWith(TEXT("(TagName="), ESearchCase::IgnoreCase) && View.EndsWith(TEXT(")")))
+		{
+			View.RightChopInline(9);
+			View.LeftChopInline(1);
+			if (View.StartsWith(TEXT("\"")) && View.EndsWith(TEXT("\"")) && View.Len() >= 2)
+			{
+				View.RightChopInline(1);
+				View.LeftChopInline(1);
+			}
+		}
+		return View.IsEmpty() ? NAME_None : FName(View.Len(), View.GetData());
+	}
+
+	// Thread-safe: only reads the asset's registry tags.
+	static FName ReadRegistryTagName(const FAssetData& AD, FName RegistryKey)
+	{
+		FString Value;
+		return AD.GetTagValue(RegistryKey, Value) ? ParseTagName(Value) : NAME_None;
+	}
+}
+
+namespace InventoryResidency
+{
+	// Counts the lookup in the residency cache; an asset only GC happened to keep alive is adopted.
+	static void NoteLookup(const FSoftObjectPath& Path, UObject* Resident)
+	{
+		UItemResidencySubsystem* Residency = IsInGameThread() ? UItemResidencySubsystem::Get() : nullptr;
+		if (Residency && !Residency->Find(Path) && Resident)
+		{
+			Residency->Add(Resident);
+		}
+	}
+
+	static void NoteLoaded(UObject* Loaded)
+	{
+		UItemResidencySubsystem* Residency = (Loaded && IsInGameThread()) ? UItemResidencySubsystem::Get() : nullptr;
+		if (Residency)
+		{
+			Residency->Add(Loaded);
+		}
+	}
+}
+
 UInventoryAssetManager& UInventoryAssetManager::Get()
 {
 	UInventoryAssetManager* Singleton = Cast<UInventoryAssetManager>(GEngine->AssetManager);
@@ -38,93 +110,328 @@ void UInventoryAssetManager::StartInitialLoading()
 {
 	Super::StartInitialLoading();
 
-	// Legacy: build item map (kept for compatibility with existing calls)
-	BuildItemIndex();
-
 	// Register common classes once (you can also do this in DefaultGame.ini via a startup BP call if you prefer)
 	RegisterTaggedClass(UItemDataAsset::StaticClass(),           TEXT("ItemIDTag"));     // ensure meta=(AssetRegistrySearchable) on property
 	RegisterTaggedClass(UCraftingRecipeDataAsset::StaticClass(), TEXT("RecipeIDTag"));   // ensure meta=(AssetRegistrySearchable)
 	RegisterTaggedClass(UXPGrantBundle::StaticClass(),           TEXT("BundleIDTag"));   // ensure meta=(AssetRegistrySearchable)
 
-	// Build generic tag indices
-	BuildGenericTagIndices();
+	// Cooked: the table written at cook time. Editor (content changes live) or stale table: full scan;
+	// a stale table is dropped whole, since any of its entries may map a tag the asset no longer has.
+	const bool bTableCurrent = FPlatformProperties::RequiresCookedData() && LoadTagIndexTable(GetTagIndexTablePath());
+	if (!bTableCurrent)
+	{
+		ClassTagIndices.Reset();
+		BuildGenericTagIndices();
+	}
+	bTagIndicesBuilt = true;
+
+	// From here on the index follows the registry instead of being rebuilt.
+	BindRegistryEvents();
+
+#if !UE_BUILD_SHIPPING
+	// Native tags are all registered by now; flag the ones nobody added to the project's tag list.
+	RPGGameplayTags::ReportMissingFromConfig();
+#endif
+
+	// Recipes stream in as one batch; station and recipe lookups go through the catalog afterwards.
+	if (URecipeCatalogSubsystem* Catalog = URecipeCatalogSubsystem::Get())
+	{
+		Catalog->Preload();
+	}
 }
 
 //
-// -------- Legacy items-only API (kept) --------
+// -------- Legacy items-only API (kept; reads the UItemDataAsset class map) --------
 //
-void UInventoryAssetManager::BuildItemIndex()
+UItemDataAsset* UInventoryAssetManager::LoadItemDataByTag(const FGameplayTag& ItemID, bool bSyncLoad)
 {
-	ItemTagToPath.Empty();
+	FSoftObjectPath Path;
+	if (!ResolveItemPathByTag(ItemID, Path))
+	{
+		return nullptr;
+	}
 
-	IAssetRegistry& AR = GetAR();
+	// Resident: no trip through the loader (which may flush pending async loads).
+	UItemDataAsset* Resident = Cast<UItemDataAsset>(Path.ResolveObject());
+	InventoryResidency::NoteLookup(Path, Resident);
+	if (Resident)
+	{
+		return Resident;
+	}
 
-	// Find all UItemDataAsset assets
-	TArray<FAssetData> Assets;
-	AR.GetAssetsByClass(UItemDataAsset::StaticClass()->GetClassPathName(), Assets, true);
+	if (bSyncLoad)
+	{
+		UItemDataAsset* Loaded = Cast<UItemDataAsset>(InventorySyncLoad::TryLoad(Path, TEXT("AssetManager.LoadItemDataByTag")));
+		InventoryResidency::NoteLoaded(Loaded);
+		return Loaded;
+	}
 
-	for (const FAssetData& AD : Assets)
+	// Async path: queue a load; the caller retries later or uses RequestItemDataByTag.
+	GetStreamableManager().RequestAsyncLoad(Path, FStreamableDelegate::CreateLambda([Path]()
 	{
-		FString TagStr;
-		// Prefer AssetRegistry tag (fast, no load)
-		if (AD.GetTagValue(TEXT("ItemIDTag"), TagStr) && !TagStr.IsEmpty())
+		InventoryResidency::NoteLoaded(Path.ResolveObject());
+	}));
+	return nullptr;
+}
+
+bool UInventoryAssetManager::ResolveItemPathByTag(const FGameplayTag& ItemID, FSoftObjectPath& OutPath) const
+{
+	return ResolveDataAssetPathByTag(ItemID, UItemDataAsset::StaticClass(), OutPath);
+}
+
+bool UInventoryAssetManager::ResolveItemTagByPath(const FSoftObjectPath& Path, FGameplayTag& OutTag) const
+{
+	return ResolveDataAssetTagByPath(Path, UItemDataAsset::StaticClass(), OutTag);
+}
+
+UItemDataAsset* UInventoryAssetManager::FindItemDataByTag(const FGameplayTag& ItemIdTag) const
+{
+	FSoftObjectPath Path;
+	return ResolveItemPathByTag(ItemIdTag, Path) ? Cast<UItemDataAsset>(Path.ResolveObject()) : nullptr;
+}
+
+//
+// -------- Non-blocking item resolution --------
+//
+TSharedPtr<FStreamableHandle> UInventoryAssetManager::RequestItemData(const TSoftObjectPtr<UItemDataAsset>& Item, FItemDataResolvedDelegate OnResolved, TAsyncLoadPriority Priority)
+{
+	if (Item.IsNull())
+	{
+		OnResolved.ExecuteIfBound(nullptr);
+		return nullptr;
+	}
+
+	const FSoftObjectPath Path = Item.ToSoftObjectPath();
+	UItemDataAsset* Resident = Item.Get();
+	InventoryResidency::NoteLookup(Path, Resident);
+	if (Resident)
+	{
+		OnResolved.ExecuteIfBound(Resident);
+		return nullptr;
+	}
+
+	if (!IsInitialized())
+	{
+		// No asset manager (commandlets): nothing to stream with.
+		OnResolved.ExecuteIfBound(Cast<UItemDataAsset>(InventorySyncLoad::TryLoad(Path, TEXT("AssetManager.RequestItemData"))));
+		return nullptr;
+	}
+
+	FStreamableDelegate Complete = FStreamableDelegate::CreateLambda([Path, OnResolved = MoveTemp(OnResolved)]()
+	{
+		UItemDataAsset* Loaded = Cast<UItemDataAsset>(Path.ResolveObject());
+		InventoryResidency::NoteLoaded(Loaded);
+		OnResolved.ExecuteIfBound(Loaded);
+	});
+
+	// Registered items bring their Gameplay bundle along.
+	return StreamItemsWithBundles(MakeArrayView(&Path, 1), GetItemBundlesToLoad(), MoveTemp(Complete), Priority);
+}
+
+TSharedPtr<FStreamableHandle> UInventoryAssetManager::RequestItemDataByTag(const FGameplayTag& ItemID, FItemDataResolvedDelegate OnResolved, TAsyncLoadPriority Priority)
+{
+	FSoftObjectPath Path;
+	if (!ResolveItemPathByTag(ItemID, Path))
+	{
+		OnResolved.ExecuteIfBound(nullptr);
+		return nullptr;
+	}
+	return RequestItemData(TSoftObjectPtr<UItemDataAsset>(Path), MoveTemp(OnResolved), Priority);
+}
+
+TSharedPtr<FStreamableHandle> UInventoryAssetManager::RequestItemDataBatch(const TArray<TSoftObjectPtr<UItemDataAsset>>& Items, FItemDataBatchResolvedDelegate OnResolved, TAsyncLoadPriority Priority)
+{
+	// Only what isn't resident goes to the streamer, once per path.
+	TArray<FSoftObjectPath> ToLoad;
+	for (const TSoftObjectPtr<UItemDataAsset>& Item : Items)
+	{
+		if (Item.IsNull()) continue;
+
+		UItemDataAsset* Resident = Item.Get();
+		InventoryResidency::NoteLookup(Item.ToSoftObjectPath(), Resident);
+		if (!Resident)
 		{
-			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*TagStr), false);
-			if (Tag.IsValid())
-			{
-				ItemTagToPath.Add(Tag, AD.ToSoftObjectPath());
-			}
-			continue;
+			ToLoad.AddUnique(Item.ToSoftObjectPath());
+		}
+	}
+
+	auto Complete = [Items, ToLoad, OnResolved = MoveTemp(OnResolved)]()
+	{
+		for (const FSoftObjectPath& Path : ToLoad)
+		{
+			InventoryResidency::NoteLoaded(Path.ResolveObject());
 		}
 
-		// Fallback: soft-load just this asset to read property (should be rare)
-		if (UObject* Obj = AD.ToSoftObjectPath().TryLoad())
+		TArray<UItemDataAsset*> Data;
+		Data.Reserve(Items.Num());
+		for (const TSoftObjectPtr<UItemDataAsset>& Item : Items)
 		{
-			if (const UItemDataAsset* DA = Cast<UItemDataAsset>(Obj))
-			{
-				if (DA->ItemIDTag.IsValid())
-				{
-					ItemTagToPath.Add(DA->ItemIDTag, AD.ToSoftObjectPath());
-				}
-			}
+			Data.Add(Item.Get());
+		}
+		OnResolved.ExecuteIfBound(Data);
+	};
+
+	if (ToLoad.Num() == 0 || !IsInitialized())
+	{
+		for (const FSoftObjectPath& Path : ToLoad)
+		{
+			InventorySyncLoad::TryLoad(Path, TEXT("AssetManager.RequestItemDataBatch"));
 		}
+		Complete();
+		return nullptr;
 	}
+
+	// One request for all of them; registered items bring their Gameplay bundles along.
+	return StreamItemsWithBundles(ToLoad, GetItemBundlesToLoad(), FStreamableDelegate::CreateLambda(MoveTemp(Complete)), Priority);
 }
 
-UItemDataAsset* UInventoryAssetManager::LoadItemDataByTag(const FGameplayTag& ItemID, bool bSyncLoad)
+TSharedPtr<FStreamableHandle> UInventoryAssetManager::RequestItemDataBatchByTag(const TArray<FGameplayTag>& ItemIDs, FItemDataBatchResolvedDelegate OnResolved, TAsyncLoadPriority Priority)
 {
-	FSoftObjectPath Path;
-	if (!ResolveItemPathByTag(ItemID, Path))
+	TArray<TSoftObjectPtr<UItemDataAsset>> Items;
+	Items.Reserve(ItemIDs.Num());
+	for (const FGameplayTag& ItemID : ItemIDs)
 	{
-		return nullptr;
+		FSoftObjectPath Path;
+		ResolveItemPathByTag(ItemID, Path);
+		Items.Emplace(Path);
 	}
+	return RequestItemDataBatch(Items, MoveTemp(OnResolved), Priority);
+}
 
-	if (bSyncLoad)
+//
+// -------- Item asset bundles --------
+//
+TArray<FName> UInventoryAssetManager::GetItemBundlesToLoad(TConstArrayView<FName> Requested)
+{
+	TArray<FName> Bundles;
+	Bundles.Add(UItemDataAsset::BundleGameplay);
+
+	// A headless server has no use for icons, meshes, FX, sounds or montages.
+	if (!IsRunningDedicatedServer())
+	{
+		for (const FName Bundle : Requested)
+		{
+			Bundles.AddUnique(Bundle);
+		}
+	}
+	return Bundles;
+}
+
+TSharedPtr<FStreamableHandle> UInventoryAssetManager::StreamItemsWithBundles(TConstArrayView<FSoftObjectPath> Paths, TConstArrayView<FName> Bundles,
+	FStreamableDelegate OnLoaded, TAsyncLoadPriority Priority)
+{
+	TArray<FSoftObjectPath> ToLoad(Paths);
+
+	// Bundle members are plain paths here: the handle owns them, not the asset manager's bundle state,
+	// so they unload once every handle (the residency cache's included) lets go.
+	if (const UInventoryAssetManager* AM = IsInitialized() ? GetOptional() : nullptr)
 	{
-		return Cast<UItemDataAsset>(Path.TryLoad());
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			const FPrimaryAssetId Id = AM->GetPrimaryAssetIdForPath(Path);
+			if (!Id.IsValid()) continue;
+
+			for (const FName Bundle : Bundles)
+			{
+				for (const FTopLevelAssetPath& AssetPath : AM->GetAssetBundleEntry(Id, Bundle).AssetPaths)
+				{
+					ToLoad.AddUnique(FSoftObjectPath(AssetPath));
+				}
+			}
+		}
 	}
 
-	// Async path: queue a load; returns nullptr immediately.
-	GetStreamableManager().RequestAsyncLoad(Path, nullptr);
-	return nullptr;
+	return GetStreamableManager().RequestAsyncLoad(MoveTemp(ToLoad), MoveTemp(OnLoaded), Priority);
 }
 
-bool UInventoryAssetManager::ResolveItemPathByTag(const FGameplayTag& ItemID, FSoftObjectPath& OutPath) const
+TSharedPtr<FStreamableHandle> UInventoryAssetManager::RequestItemBundles(const TSoftObjectPtr<UItemDataAsset>& Item, const TArray<FName>& Bundles, FItemDataResolvedDelegate OnResolved, TAsyncLoadPriority Priority)
 {
-	if (const FSoftObjectPath* Found = ItemTagToPath.Find(ItemID))
+	const FSoftObjectPath Path = Item.ToSoftObjectPath();
+	UInventoryAssetManager* AM = IsInitialized() ? GetOptional() : nullptr;
+	const FPrimaryAssetId Id = (AM && !Item.IsNull()) ? AM->GetPrimaryAssetIdForPath(Path) : FPrimaryAssetId();
+	if (!Id.IsValid())
 	{
-		OutPath = *Found;
-		return true;
+		return RequestItemData(Item, MoveTemp(OnResolved), Priority);
 	}
-	return false;
+
+	InventoryResidency::NoteLookup(Path, Item.Get());
+
+	// Additive: bundles another caller asked for stay loaded while their handle lives.
+	return StreamItemsWithBundles(MakeArrayView(&Path, 1), GetItemBundlesToLoad(Bundles),
+		FStreamableDelegate::CreateLambda([Path, OnResolved = MoveTemp(OnResolved)]()
+		{
+			// Re-added so the estimate includes the bundles just loaded.
+			UItemDataAsset* Loaded = Cast<UItemDataAsset>(Path.ResolveObject());
+			InventoryResidency::NoteLoaded(Loaded);
+			OnResolved.ExecuteIfBound(Loaded);
+		}), Priority);
 }
 
-UItemDataAsset* UInventoryAssetManager::FindItemDataByTag(const FGameplayTag& ItemIdTag) const
+void UInventoryAssetManager::LogItemBundleMemory() const
 {
-	FSoftObjectPath Path;
-	return ResolveItemPathByTag(ItemIdTag, Path) ? Cast<UItemDataAsset>(Path.ResolveObject()) : nullptr;
+	struct FBundleTotals
+	{
+		TSet<FSoftObjectPath> Assets; // shared assets (one montage, many items) count once per bundle
+		int32 Resident = 0;
+		SIZE_T Bytes = 0;
+
+		void Add(const FSoftObjectPath& Path)
+		{
+			bool bAlreadyIn = false;
+			Assets.Add(Path, &bAlreadyIn);
+			if (bAlreadyIn) return;
+
+			if (UObject* Obj = Path.ResolveObject())
+			{
+				++Resident;
+				Bytes += Obj->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+			}
+		}
+	};
+
+	TArray<FPrimaryAssetId> Ids;
+	GetPrimaryAssetIdList(UItemDataAsset::ItemPrimaryAssetType, Ids);
+
+	FBundleTotals Definitions;
+	TMap<FName, FBundleTotals> Bundles;
+
+	for (const FPrimaryAssetId& Id : Ids)
+	{
+		Definitions.Add(GetPrimaryAssetPath(Id));
+
+		TArray<FAssetBundleEntry> Entries;
+		GetAssetBundleEntries(Id, Entries);
+		for (const FAssetBundleEntry& Entry : Entries)
+		{
+			FBundleTotals& Totals = Bundles.FindOrAdd(Entry.BundleName);
+			for (const FTopLevelAssetPath& AssetPath : Entry.AssetPaths)
+			{
+				Totals.Add(FSoftObjectPath(AssetPath));
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[Assets] Item bundles (%s):"), IsRunningDedicatedServer() ? TEXT("dedicated server") : TEXT("client"));
+	UE_LOG(LogTemp, Log, TEXT("[Assets]   %-12s %5d assets, %5d resident, %8.2f MB"), TEXT("Definitions"),
+		Definitions.Assets.Num(), Definitions.Resident, Definitions.Bytes / (1024.0 * 1024.0));
+	for (const TPair<FName, FBundleTotals>& It : Bundles)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[Assets]   %-12s %5d assets, %5d resident, %8.2f MB"), *It.Key.ToString(),
+			It.Value.Assets.Num(), It.Value.Resident, It.Value.Bytes / (1024.0 * 1024.0));
+	}
 }
 
+static FAutoConsoleCommand GItemBundleMemoryCmd(
+	TEXT("Inventory.BundleMemory"),
+	TEXT("Inventory.BundleMemory - log resident assets and estimated size per item asset bundle."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (const UInventoryAssetManager* AM = UAssetManager::IsInitialized() ? UInventoryAssetManager::GetOptional() : nullptr)
+		{
+			AM->LogItemBundleMemory();
+		}
+	}));
+
 //
 // -------- NEW: Generic tagged asset API --------
 //
@@ -135,71 +442,294 @@ void UInventoryAssetManager::RegisterTaggedClass(TSubclassOf<UDataAsset> AssetCl
 		return;
 	}
 
-	FTaggedClassCfg Cfg;
+	// Registering a class again replaces its config.
+	int32 CfgIdx = TaggedClassConfigs.IndexOfByPredicate([&AssetClass](const FTaggedClassCfg& Cfg) { return Cfg.AssetClass == AssetClass.Get(); });
+	if (CfgIdx == INDEX_NONE)
+	{
+		CfgIdx = TaggedClassConfigs.AddDefaulted();
+	}
+
+	FTaggedClassCfg& Cfg = TaggedClassConfigs[CfgIdx];
 	Cfg.AssetClass = AssetClass.Get();
 	Cfg.TagProp    = TagPropertyName;
 	Cfg.RegistryKey= (AssetRegistryKeyName == NAME_None) ? TagPropertyName : AssetRegistryKeyName;
 
-	TaggedClassConfigs.Add(Cfg);
+	ConfigsByAssetClass.Reset();
+
+	// Registered after startup: index just this class; the registry events keep it current afterwards.
+	if (bTagIndicesBuilt)
+	{
+		ClassTagIndices.Remove(Cfg.AssetClass);
+		IndexTaggedClasses(MakeArrayView(&CfgIdx, 1));
+	}
 }
 
 void UInventoryAssetManager::BuildGenericTagIndices()
 {
-	ClassToTagMap.Empty();
+	const double Start = FPlatformTime::Seconds();
 
-	for (const FTaggedClassCfg& Cfg : TaggedClassConfigs)
+	TArray<int32> All;
+	All.Reserve(TaggedClassConfigs.Num());
+	for (int32 i = 0; i < TaggedClassConfigs.Num(); ++i)
 	{
-		if (UClass* Cls = Cfg.AssetClass)
-		{
-			IndexTaggedClass(Cls, Cfg.TagProp, Cfg.RegistryKey);
-		}
+		All.Add(i);
 	}
-}
+	IndexTaggedClasses(All);
 
-void UInventoryAssetManager::IndexTaggedClass(UClass* InClass, FName TagPropName, FName AssetRegistryKeyName)
-{
-	if (!InClass)
+	int32 NumEntries = 0;
+	for (const TPair<UClass*, FClassTagIndex>& It : ClassTagIndices)
 	{
-		return;
+		NumEntries += It.Value.ByTag.Num();
 	}
+	UE_LOG(LogTemp, Log, TEXT("[Assets] Tag index: %d classes, %d entries in %.2f ms"),
+		TaggedClassConfigs.Num(), NumEntries, (FPlatformTime::Seconds() - Start) * 1000.0);
+}
 
+void UInventoryAssetManager::IndexTaggedClasses(TConstArrayView<int32> CfgIndices)
+{
 	IAssetRegistry& AR = GetAR();
 
-	TArray<FAssetData> Assets;
-	AR.GetAssetsByClass(InClass->GetClassPathName(), Assets, true);
+	struct FScannedAsset
+	{
+		int32 Cfg = INDEX_NONE;
+		FAssetData Asset;
+		FName TagName;
+	};
+	TArray<FScannedAsset> Scanned;
+
+	// Registry queries on the game thread; they serialize on the registry's lock anyway.
+	for (const int32 CfgIdx : CfgIndices)
+	{
+		const FTaggedClassCfg& Cfg = TaggedClassConfigs[CfgIdx];
+		if (!Cfg.AssetClass) continue;
 
-	TMap<FGameplayTag, FSoftObjectPath>& Map = ClassToTagMap.FindOrAdd(InClass);
+		TArray<FAssetData> Assets;
+		AR.GetAssetsByClass(Cfg.AssetClass->GetClassPathName(), Assets, true);
 
-	for (const FAssetData& AD : Assets)
-	{
-		FGameplayTag FoundTag;
+		// Every asset is re-read: an entry we already hold may carry a tag the asset no longer has.
+		ClassTagIndices.Add(Cfg.AssetClass, FClassTagIndex());
 
-		// 1) Fast path: grab searchable value from AssetRegistry (requires meta=(AssetRegistrySearchable) or GetAssetRegistryTags override)
-		FString TagStr;
-		if (AD.GetTagValue(AssetRegistryKeyName, TagStr) && !TagStr.IsEmpty())
+		Scanned.Reserve(Scanned.Num() + Assets.Num());
+		for (FAssetData& AD : Assets)
 		{
-			FoundTag = FGameplayTag::RequestGameplayTag(FName(*TagStr), false);
+			FScannedAsset& S = Scanned.AddDefaulted_GetRef();
+			S.Cfg   = CfgIdx;
+			S.Asset = MoveTemp(AD);
 		}
+	}
 
-		// 2) Slow path (rare): property wasn't exported to registry — soft-load the asset and read it via reflection.
+	// Reading and parsing the registry strings is independent per asset, across every class at once.
+	ParallelFor(Scanned.Num(), [this, &Scanned](int32 i)
+	{
+		FScannedAsset& S = Scanned[i];
+		S.TagName = InventoryTagIndex::ReadRegistryTagName(S.Asset, TaggedClassConfigs[S.Cfg].RegistryKey);
+	});
+
+	// Game thread: tag lookups go through the cache; the rare asset without a searchable tag is soft-loaded.
+	for (const FScannedAsset& S : Scanned)
+	{
+		const FTaggedClassCfg& Cfg = TaggedClassConfigs[S.Cfg];
+
+		FGameplayTag FoundTag = ResolveTagName(S.TagName);
 		if (!FoundTag.IsValid())
 		{
-			if (UObject* Obj = AD.ToSoftObjectPath().TryLoad())
+			if (UObject* Obj = InventorySyncLoad::TryLoad(S.Asset.ToSoftObjectPath(), TEXT("AssetManager.IndexTaggedClasses")))
 			{
-				if (TryReadGameplayTagProperty(Obj, TagPropName, FoundTag) && FoundTag.IsValid())
-				{
-					// ok
-				}
+				TryReadGameplayTagProperty(Obj, Cfg.TagProp, FoundTag);
 			}
 		}
 
 		if (FoundTag.IsValid())
 		{
-			Map.FindOrAdd(FoundTag) = AD.ToSoftObjectPath();
+			AddIndexEntry(ClassTagIndices.FindOrAdd(Cfg.AssetClass), FoundTag, S.Asset.ToSoftObjectPath());
 		}
 	}
 }
 
+void UInventoryAssetManager::IndexAsset(int32 CfgIdx, const FAssetData& AD)
+{
+	const FTaggedClassCfg& Cfg = TaggedClassConfigs[CfgIdx];
+	const FSoftObjectPath Path = AD.ToSoftObjectPath();
+
+	const FGameplayTag FoundTag = ResolveTagName(InventoryTagIndex::ReadRegistryTagName(AD, Cfg.RegistryKey));
+	if (FoundTag.IsValid())
+	{
+		AddIndexEntry(ClassTagIndices.FindOrAdd(Cfg.AssetClass), FoundTag, Path);
+		return;
+	}
+
+	// Not inside a registry callback: loading from there can re-enter the registry.
+	FPendingSlowPath& Pending = PendingSlowPath.AddDefaulted_GetRef();
+	Pending.Cfg  = CfgIdx;
+	Pending.Path = Path;
+
+	// While the registry is still scanning, HandleFilesLoaded flushes instead.
+	if (!bSlowPathFlushQueued && !GetAR().IsLoadingAssets())
+	{
+		bSlowPathFlushQueued = true;
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+		{
+			FlushPendingSlowPath();
+			return false;
+		}));
+	}
+}
+
+void UInventoryAssetManager::FlushPendingSlowPath()
+{
+	bSlowPathFlushQueued = false;
+
+	const TArray<FPendingSlowPath> Pending = MoveTemp(PendingSlowPath);
+	PendingSlowPath.Reset();
+
+	for (const FPendingSlowPath& P : Pending)
+	{
+		if (!TaggedClassConfigs.IsValidIndex(P.Cfg)) continue;
+		const FTaggedClassCfg& Cfg = TaggedClassConfigs[P.Cfg];
+
+		FGameplayTag FoundTag;
+		UObject* Obj = InventorySyncLoad::TryLoad(P.Path, TEXT("AssetManager.FlushPendingSlowPath"));
+		if (Obj && TryReadGameplayTagProperty(Obj, Cfg.TagProp, FoundTag) && FoundTag.IsValid())
+		{
+			AddIndexEntry(ClassTagIndices.FindOrAdd(Cfg.AssetClass), FoundTag, P.Path);
+		}
+	}
+}
+
+FGameplayTag UInventoryAssetManager::ResolveTagName(FName TagName)
+{
+	if (TagName.IsNone())
+	{
+		return FGameplayTag();
+	}
+
+	if (const FGameplayTag* Cached = ParsedTagCache.Find(TagName))
+	{
+		return *Cached;
+	}
+
+	// Misses are not cached: the tag may be registered later (plugin or DLC tag tables).
+	const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+	if (Tag.IsValid())
+	{
+		ParsedTagCache.Add(TagName, Tag);
+	}
+	return Tag;
+}
+
+const TArray<int32>& UInventoryAssetManager::GetConfigsForAssetClass(const FTopLevelAssetPath& ClassPath)
+{
+	if (const TArray<int32>* Cached = ConfigsByAssetClass.Find(ClassPath))
+	{
+		return *Cached;
+	}
+
+	TArray<FTopLevelAssetPath> Lineage;
+	GetAR().GetAncestorClassNames(ClassPath, Lineage);
+	Lineage.Add(ClassPath);
+
+	TArray<int32>& Configs = ConfigsByAssetClass.Add(ClassPath);
+	for (int32 i = 0; i < TaggedClassConfigs.Num(); ++i)
+	{
+		const UClass* Cls = TaggedClassConfigs[i].AssetClass;
+		if (Cls && Lineage.Contains(Cls->GetClassPathName()))
+		{
+			Configs.Add(i);
+		}
+	}
+	return Configs;
+}
+
+void UInventoryAssetManager::AddIndexEntry(FClassTagIndex& Index, const FGameplayTag& Tag, const FSoftObjectPath& Path)
+{
+	// The asset may have carried another tag before (re-saved with a new ID).
+	RemoveIndexEntry(Index, Path);
+
+	// Duplicate IDs: the last one indexed wins, as before.
+	FSoftObjectPath& Slot = Index.ByTag.FindOrAdd(Tag);
+	if (!Slot.IsNull() && Slot != Path)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Assets] Tag %s used by %s and %s; keeping the latter."),
+			*Tag.ToString(), *Slot.ToString(), *Path.ToString());
+		Index.ByPath.Remove(Slot);
+	}
+	Slot = Path;
+	Index.ByPath.Add(Path, Tag);
+}
+
+void UInventoryAssetManager::RemoveIndexEntry(FClassTagIndex& Index, const FSoftObjectPath& Path)
+{
+	FGameplayTag Tag;
+	if (!Index.ByPath.RemoveAndCopyValue(Path, Tag))
+	{
+		return;
+	}
+
+	if (const FSoftObjectPath* Current = Index.ByTag.Find(Tag); Current && *Current == Path)
+	{
+		Index.ByTag.Remove(Tag);
+	}
+}
+
+//
+// -------- Incremental updates from the asset registry --------
+//
+void UInventoryAssetManager::BindRegistryEvents()
+{
+	IAssetRegistry& AR = GetAR();
+	AR.OnAssetAdded().AddUObject(this, &UInventoryAssetManager::HandleAssetAdded);
+	AR.OnAssetRemoved().AddUObject(this, &UInventoryAssetManager::HandleAssetRemoved);
+	AR.OnAssetRenamed().AddUObject(this, &UInventoryAssetManager::HandleAssetRenamed);
+	AR.OnAssetUpdated().AddUObject(this, &UInventoryAssetManager::HandleAssetUpdated);
+	AR.OnFilesLoaded().AddUObject(this, &UInventoryAssetManager::HandleFilesLoaded);
+}
+
+void UInventoryAssetManager::HandleAssetAdded(const FAssetData& AD)
+{
+	for (const int32 CfgIdx : GetConfigsForAssetClass(AD.AssetClassPath))
+	{
+		IndexAsset(CfgIdx, AD);
+	}
+}
+
+void UInventoryAssetManager::HandleAssetRemoved(const FAssetData& AD)
+{
+	const FSoftObjectPath Path = AD.ToSoftObjectPath();
+	for (TPair<UClass*, FClassTagIndex>& It : ClassTagIndices)
+	{
+		RemoveIndexEntry(It.Value, Path);
+	}
+	PendingSlowPath.RemoveAll([&Path](const FPendingSlowPath& P) { return P.Path == Path; });
+}
+
+void UInventoryAssetManager::HandleAssetRenamed(const FAssetData& AD, const FString& OldObjectPath)
+{
+	const FSoftObjectPath OldPath(OldObjectPath);
+	for (TPair<UClass*, FClassTagIndex>& It : ClassTagIndices)
+	{
+		RemoveIndexEntry(It.Value, OldPath);
+	}
+	PendingSlowPath.RemoveAll([&OldPath](const FPendingSlowPath& P) { return P.Path == OldPath; });
+
+	HandleAssetAdded(AD);
+}
+
+void UInventoryAssetManager::HandleAssetUpdated(const FAssetData& AD)
+{
+	// Only the registered classes care; their ID tag may have changed on save.
+	if (GetConfigsForAssetClass(AD.AssetClassPath).Num() == 0) return;
+
+	HandleAssetRemoved(AD);
+	HandleAssetAdded(AD);
+}
+
+void UInventoryAssetManager::HandleFilesLoaded()
+{
+	// Blueprint class lineage is only complete once the scan finished.
+	ConfigsByAssetClass.Reset();
+	FlushPendingSlowPath();
+}
+
 bool UInventoryAssetManager::TryReadGameplayTagProperty(UObject* Obj, FName TagPropName, FGameplayTag& OutTag)
 {
 	if (!Obj) return false;
@@ -220,6 +750,177 @@ bool UInventoryAssetManager::TryReadGameplayTagProperty(UObject* Obj, FName TagP
 	return true;
 }
 
+//
+// -------- Cooked tag index table --------
+//
+FString UInventoryAssetManager::GetTagIndexTablePath()
+{
+	return FPaths::ProjectContentDir() / TEXT("RPGSystem/InventoryTagIndex.bin");
+}
+
+uint64 UInventoryAssetManager::ComputeTagIndexPackageStamp(const TSet<FName>* OnlyPackages) const
+{
+	IAssetRegistry& AR = GetAR();
+
+	uint64 Stamp = InventoryTagIndex::Version;
+	FARFilter Filter;
+	Filter.bRecursiveClasses = true;
+	for (const FTaggedClassCfg& Cfg : TaggedClassConfigs)
+	{
+		if (!Cfg.AssetClass) continue;
+
+		Filter.ClassPaths.Add(Cfg.AssetClass->GetClassPathName());
+		const uint64 ClassHash = InventoryTagIndex::HashString(Cfg.AssetClass->GetClassPathName().ToString() + TEXT(":") + Cfg.TagProp.ToString());
+		Stamp = CityHash128to64(Uint128_64(Stamp, ClassHash));
+	}
+	if (Filter.ClassPaths.IsEmpty()) return Stamp;
+
+	// Package names only, summed so registry order doesn't matter: no tag values are read or parsed.
+	uint64 PackageSum = 0;
+	AR.EnumerateAssets(Filter, [&PackageSum, OnlyPackages](const FAssetData& AD)
+	{
+		if (!OnlyPackages || OnlyPackages->Contains(AD.PackageName))
+		{
+			const FNameBuilder Name(AD.PackageName);
+			PackageSum += CityHash64(reinterpret_cast<const char*>(Name.GetData()), Name.Len() * sizeof(TCHAR)) + 1;
+		}
+		return true;
+	});
+	return CityHash128to64(Uint128_64(Stamp, PackageSum));
+}
+
+bool UInventoryAssetManager::WriteTagIndexTable(const FString& FilePath, const TSet<FName>* CookedPackages)
+{
+	// Offline, so the slow path (soft-load assets whose tag isn't searchable) is fine here.
+	ClassTagIndices.Reset();
+	BuildGenericTagIndices();
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Ar(Bytes);
+
+	uint32 Magic   = InventoryTagIndex::Magic;
+	uint32 Version = InventoryTagIndex::Version;
+	uint64 Stamp   = ComputeTagIndexPackageStamp(CookedPackages);
+	int32 NumClasses = TaggedClassConfigs.Num();
+	Ar << Magic << Version << Stamp << NumClasses;
+
+	int32 NumEntries = 0;
+	for (const FTaggedClassCfg& Cfg : TaggedClassConfigs)
+	{
+		FString ClassPath = Cfg.AssetClass ? Cfg.AssetClass->GetClassPathName().ToString() : FString();
+		Ar << ClassPath;
+
+		TArray<TPair<FString, FString>> Entries;
+		if (const FClassTagIndex* Index = ClassTagIndices.Find(Cfg.AssetClass))
+		{
+			Entries.Reserve(Index->ByTag.Num());
+			for (const TPair<FGameplayTag, FSoftObjectPath>& It : Index->ByTag)
+			{
+				if (CookedPackages && !CookedPackages->Contains(It.Value.GetLongPackageFName())) continue;
+				Entries.Emplace(It.Key.ToString(), It.Value.ToString());
+			}
+		}
+
+		// Sorted, so identical content writes identical bytes.
+		Entries.Sort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B) { return A.Key < B.Key; });
+
+		int32 Num = Entries.Num();
+		Ar << Num;
+		for (TPair<FString, FString>& It : Entries)
+		{
+			Ar << It.Key << It.Value;
+		}
+		NumEntries += Num;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[Assets] Could not write tag index table %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[Assets] Wrote tag index table %s: %d classes, %d entries, %d bytes"),
+		*FilePath, NumClasses, NumEntries, Bytes.Num());
+	return true;
+}
+
+bool UInventoryAssetManager::LoadTagIndexTable(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Ar(Bytes);
+
+	uint32 Magic = 0, Version = 0;
+	uint64 Stamp = 0;
+	int32 NumClasses = 0;
+	Ar << Magic << Version << Stamp << NumClasses;
+
+	if (Ar.IsError() || Magic != InventoryTagIndex::Magic || Version != InventoryTagIndex::Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Assets] Tag index table %s is unreadable; scanning instead."), *FilePath);
+		return false;
+	}
+	TMap<UClass*, FClassTagIndex> Loaded;
+	for (int32 c = 0; c < NumClasses && !Ar.IsError(); ++c)
+	{
+		FString ClassPath;
+		int32 Num = 0;
+		Ar << ClassPath << Num;
+
+		UClass* Cls = FindObject<UClass>(FTopLevelAssetPath(ClassPath));
+		FClassTagIndex* Index = Cls ? &Loaded.FindOrAdd(Cls) : nullptr;
+		if (Index)
+		{
+			Index->ByTag.Reserve(Num);
+			Index->ByPath.Reserve(Num);
+		}
+
+		for (int32 i = 0; i < Num && !Ar.IsError(); ++i)
+		{
+			FString TagStr, PathStr;
+			Ar << TagStr << PathStr;
+
+			const FGameplayTag Tag = ResolveTagName(FName(*TagStr));
+			if (Index && Tag.IsValid())
+			{
+				AddIndexEntry(*Index, Tag, FSoftObjectPath(PathStr));
+			}
+		}
+	}
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Assets] Tag index table %s is truncated; scanning instead."), *FilePath);
+		return false;
+	}
+
+	// Tag values come from the same cook as the table, so only the package list can have moved since:
+	// patch, DLC or mod content mounted at boot. On a mismatch the caller rescans.
+	if (Stamp != ComputeTagIndexPackageStamp())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[Assets] Tag index table %s does not match the asset registry; scanning instead."), *FilePath);
+		return false;
+	}
+
+	ClassTagIndices = MoveTemp(Loaded);
+	return true;
+}
+
+#if WITH_EDITOR
+void UInventoryAssetManager::PreSaveAssetRegistry(const ITargetPlatform* TargetPlatform, const TSet<FName>& InCookedPackages)
+{
+	Super::PreSaveAssetRegistry(TargetPlatform, InCookedPackages);
+
+	// Only now is the cooked set final; stamping it keeps editor-only or uncooked assets out of a
+	// table the cooked registry would otherwise never match.
+	WriteTagIndexTable(GetTagIndexTablePath(), &InCookedPackages);
+}
+#endif
+
 bool UInventoryAssetManager::ResolveDataAssetPathByTag(const FGameplayTag& Tag, TSubclassOf<UDataAsset> AssetClass, FSoftObjectPath& OutPath) const
 {
 	if (!AssetClass || !Tag.IsValid())
@@ -227,10 +928,10 @@ bool UInventoryAssetManager::ResolveDataAssetPathByTag(const FGameplayTag& Tag,
 		return false;
 	}
 
-	const TMap<FGameplayTag, FSoftObjectPath>* Map = ClassToTagMap.Find(AssetClass.Get());
-	if (!Map) return false;
+	const FClassTagIndex* Index = ClassTagIndices.Find(AssetClass.Get());
+	if (!Index) return false;
 
-	if (const FSoftObjectPath* Found = Map->Find(Tag))
+	if (const FSoftObjectPath* Found = Index->ByTag.Find(Tag))
 	{
 		OutPath = *Found;
 		return true;
@@ -239,6 +940,21 @@ bool UInventoryAssetManager::ResolveDataAssetPathByTag(const FGameplayTag& Tag,
 	return false;
 }
 
+bool UInventoryAssetManager::ResolveDataAssetTagByPath(const FSoftObjectPath& Path, TSubclassOf<UDataAsset> AssetClass, FGameplayTag& OutTag) const
+{
+	if (!AssetClass || Path.IsNull())
+	{
+		return false;
+	}
+
+	const FClassTagIndex* Index = ClassTagIndices.Find(AssetClass.Get());
+	const FGameplayTag* Found = Index ? Index->ByPath.Find(Path) : nullptr;
+	if (!Found) return false;
+
+	OutTag = *Found;
+	return true;
+}
+
 UDataAsset* UInventoryAssetManager::LoadDataAssetByTag(const FGameplayTag& Tag, TSubclassOf<UDataAsset> AssetClass, bool bSyncLoad)
 {
 	FSoftObjectPath Path;
@@ -247,13 +963,50 @@ UDataAsset* UInventoryAssetManager::LoadDataAssetByTag(const FGameplayTag& Tag,
 		return nullptr;
 	}
 
+	UDataAsset* Resident = Cast<UDataAsset>(Path.ResolveObject());
+	InventoryResidency::NoteLookup(Path, Resident);
+	if (Resident)
+	{
+		return Resident;
+	}
+
 	if (bSyncLoad)
 	{
-		return Cast<UDataAsset>(Path.TryLoad());
+		UDataAsset* Loaded = Cast<UDataAsset>(InventorySyncLoad::TryLoad(Path, TEXT("AssetManager.LoadDataAssetByTag")));
+		InventoryResidency::NoteLoaded(Loaded);
+		return Loaded;
 	}
 
-	GetStreamableManager().RequestAsyncLoad(Path, nullptr);
+	GetStreamableManager().RequestAsyncLoad(Path, FStreamableDelegate::CreateLambda([Path]()
+	{
+		InventoryResidency::NoteLoaded(Path.ResolveObject());
+	}));
 	return nullptr;
 }
 
+TSharedPtr<FStreamableHandle> UInventoryAssetManager::RequestDataAssetByTag(const FGameplayTag& Tag, TSubclassOf<UDataAsset> AssetClass, FDataAssetResolvedDelegate OnResolved, TAsyncLoadPriority Priority)
+{
+	FSoftObjectPath Path;
+	if (!ResolveDataAssetPathByTag(Tag, AssetClass, Path))
+	{
+		OnResolved.ExecuteIfBound(nullptr);
+		return nullptr;
+	}
+
+	UDataAsset* Resident = Cast<UDataAsset>(Path.ResolveObject());
+	InventoryResidency::NoteLookup(Path, Resident);
+	if (Resident)
+	{
+		OnResolved.ExecuteIfBound(Resident);
+		return nullptr;
+	}
+
+	return GetStreamableManager().RequestAsyncLoad(Path, FStreamableDelegate::CreateLambda([Path, OnResolved = MoveTemp(OnResolved)]()
+	{
+		UDataAsset* Loaded = Cast<UDataAsset>(Path.ResolveObject());
+		InventoryResidency::NoteLoaded(Loaded);
+		OnResolved.ExecuteIfBound(Loaded);
+	}), Priority);
+}
+
 
@@ -5,10 +5,12 @@
 #include "GameFramework/Pawn.h"
 #include "Net/UnrealNetwork.h"
 #include "Inventory/ItemDataAsset.h"
+#include "Inventory/SyncLoadStats.h"
+#include "GAS/RPGGameplayTags.h"
 //
-static FGameplayTag GT_Public()   { return FGameplayTag::RequestGameplayTag(TEXT("Inventory.Access.Public"),   false); }
-static FGameplayTag GT_ViewOnly() { return FGameplayTag::RequestGameplayTag(TEXT("Inventory.Access.ViewOnly"), false); }
-static FGameplayTag GT_Private()  { return FGameplayTag::RequestGameplayTag(TEXT("Inventory.Access.Private"),  false); }
+static FGameplayTag GT_Public()   { return TAG_Inventory_Access_Public; }
+static FGameplayTag GT_ViewOnly() { return TAG_Inventory_Access_ViewOnly; }
+static FGameplayTag GT_Private()  { return TAG_Inventory_Access_Private; }
 //
 UInventoryComponent::UInventoryComponent()
 {
@@ -20,40 +22,72 @@ void UInventoryComponent::BeginPlay()
 	Super::BeginPlay();
 	AdjustSlotCountIfNeeded();
 	RecalculateWeightAndVolume();
+	RefreshResidencyPins();
+}
+void UInventoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ResidencyPins.Reset();
+	Super::EndPlay(EndPlayReason);
+}
+void UInventoryComponent::RefreshResidencyPins()
+{
+	TArray<FSoftObjectPath, TInlineAllocator<32>> Paths;
+	for (const FInventoryItem& S : Items)
+	{
+		if (S.IsValid()) Paths.Add(S.ItemData.ToSoftObjectPath());
+	}
+	ResidencyPins.Sync(Paths);
 }
 void UInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(UInventoryComponent, Items);
 	DOREPLIFETIME(UInventoryComponent, AccessTag);
+	DOREPLIFETIME(UInventoryComponent, ReservedQuantities);
 }
 void UInventoryComponent::OnRep_InventoryItems()
 {
 	const int32 OldNum = ClientPrevItems.Num();
 	const int32 NewNum = Items.Num();
 
-	
+	// Replication carries no move detail: a swap arrives as two changed slots, a resize as a full refresh.
+	FInventoryDelta Delta;
+	Delta.bFullRefresh = (OldNum != NewNum);
+
 	const int32 Overlap = FMath::Min(OldNum, NewNum);
 	for (int32 i = 0; i < Overlap; ++i)
 	{
 		if (!ItemsEqual_Client(ClientPrevItems[i], Items[i]))
 		{
+			Delta.ChangedSlots.Add(i);
 			OnInventoryUpdated.Broadcast(i);
 		}
 	}
 
-	
-	if (OldNum != NewNum)
+	ClientPrevItems = Items;
+	RefreshResidencyPins();
+
+	if (!Delta.IsEmpty()) OnInventoryDelta.Broadcast(this, Delta);
+	OnInventoryChanged.Broadcast();
+}
+void UInventoryComponent::OnRep_ReservedQuantities()
+{
+	TMap<FGameplayTag, int32> Previous = MoveTemp(ReservedByTag);
+	ReservedByTag.Reset();
+
+	TArray<FGameplayTag> Changed;
+	for (const FInventoryReservedQuantity& R : ReservedQuantities)
 	{
-		OnInventoryChanged.Broadcast();
+		ReservedByTag.Add(R.ItemIDTag, R.Quantity);
+		int32 Was = 0;
+		if (!Previous.RemoveAndCopyValue(R.ItemIDTag, Was) || Was != R.Quantity) Changed.Add(R.ItemIDTag);
 	}
-	else
+	for (const TPair<FGameplayTag, int32>& Gone : Previous)
 	{
-		
-		OnInventoryChanged.Broadcast();
+		Changed.Add(Gone.Key);
 	}
 
-	ClientPrevItems = Items; 
+	if (Changed.Num() > 0) OnReservationsChanged.Broadcast(this, Changed);
 }
 void UInventoryComponent::OnRep_AccessTag(){}
 void UInventoryComponent::SetInventoryAccess(const FGameplayTag& NewAccessTag)
@@ -111,12 +145,19 @@ bool UInventoryComponent::CanModify(AActor* Requestor) const
 }
 void UInventoryComponent::NotifySlotChanged(int32 SlotIndex)
 {
+	PendingDelta.ChangedSlots.AddUnique(SlotIndex);
 	OnInventoryUpdated.Broadcast(SlotIndex);
 }
+void UInventoryComponent::NotifySlotMoved(int32 FromIndex, int32 ToIndex)
+{
+	PendingDelta.Moves.Emplace(FromIndex, ToIndex);
+	OnInventoryUpdated.Broadcast(ToIndex);
+}
 void UInventoryComponent::NotifyInventoryChanged()
 {
 	const bool PrevFull = bWasFull;
 	RecalculateWeightAndVolume();
+	RefreshResidencyPins();
 
 	const bool NowFull = IsInventoryFull();
 	if (NowFull != PrevFull)
@@ -125,12 +166,29 @@ void UInventoryComponent::NotifyInventoryChanged()
 		OnInventoryFull.Broadcast(NowFull);
 	}
 
+	// Listeners may edit the inventory again; hand them a snapshot and start a fresh batch.
+	FInventoryDelta Delta = MoveTemp(PendingDelta);
+	PendingDelta.Reset();
+	if (Delta.IsEmpty()) Delta.bFullRefresh = true;
+	OnInventoryDelta.Broadcast(this, Delta);
+
 	OnInventoryChanged.Broadcast();
 }
 void UInventoryComponent::UpdateItemIndexes()
 {
 	for (int32 i = 0; i < Items.Num(); ++i) Items[i].Index = i;
 }
+void UInventoryComponent::RecordReorder()
+{
+	// Call after reordering Items whose Index still holds the pre-sort position.
+	for (int32 i = 0; i < Items.Num(); ++i)
+	{
+		const int32 From = Items[i].Index;
+		if (Items[i].IsValid() && From != i && From != INDEX_NONE) NotifySlotMoved(From, i);
+		else if (From != i) PendingDelta.ChangedSlots.AddUnique(i);
+	}
+	UpdateItemIndexes();
+}
 void UInventoryComponent::AdjustSlotCountIfNeeded()
 {
 	MaxSlots = FMath::Max(0, MaxSlots);
@@ -163,7 +221,7 @@ int32 UInventoryComponent::FindStackableSlot(UItemDataAsset* ItemData) const
 int32 UInventoryComponent::FindSlotWithItemID(FGameplayTag ItemID) const
 {
 	if (!ItemID.IsValid()) return INDEX_NONE;
-	for (int32 i=0;i<Items.Num();++i){ const FInventoryItem& S=Items[i]; if(!S.IsValid()) continue; if(const UItemDataAsset* D=S.ItemData.Get()){ if (D->ItemIDTag==ItemID) return i; } }
+	for (int32 i=0;i<Items.Num();++i){ const FInventoryItem& S=Items[i]; if(S.IsValid() && S.GetItemIDTag()==ItemID) return i; }
 	return INDEX_NONE;
 }
 FInventoryItem UInventoryComponent::GetItemByID(FGameplayTag ItemID) const
@@ -175,7 +233,8 @@ int32 UInventoryComponent::GetNumOccupiedSlots() const { int32 C=0; for(const FI
 int32 UInventoryComponent::GetNumItemsOfType(FGameplayTag ItemID) const
 {
 	if(!ItemID.IsValid()) return 0; int32 T=0;
-	for(const FInventoryItem& S:Items){ if(!S.IsValid()) continue; if(const UItemDataAsset* D=S.ItemData.Get()){ if(D->ItemIDTag==ItemID) T+=S.Quantity; } }
+	// By tag index, so stacks whose definition isn't resident still count.
+	for(const FInventoryItem& S:Items){ if(S.IsValid() && S.GetItemIDTag()==ItemID) T+=S.Quantity; }
 	return T;
 }
 int32 UInventoryComponent::GetNumUISlots() const { return Items.Num(); }
@@ -254,6 +313,7 @@ bool UInventoryComponent::RemoveItem(int32 SlotIndex, int32 Quantity, AActor* Re
 
 	FInventoryItem& S=Items[SlotIndex]; if(!S.IsValid()) return false;
 	const int32 RemovedQty = FMath::Min(S.Quantity, Quantity);
+	if(!CanWithdraw(S, RemovedQty)) return false;
 	FInventoryItem Removed=S; Removed.Quantity=RemovedQty;
 
 	S.Quantity -= Quantity; if(S.Quantity<=0) S = FInventoryItem();
@@ -274,10 +334,17 @@ bool UInventoryComponent::MoveItem(int32 FromIndex, int32 ToIndex, AActor* Reque
 	FInventoryItem& A=Items[FromIndex]; FInventoryItem& B=Items[ToIndex];
 	if(!A.IsValid()) return false;
 
-	if(B.IsValid() && A.CanStackWith(B.ItemData.Get())) { B.Quantity += A.Quantity; A=FInventoryItem(); }
-	else { Swap(A,B); }
-
-	NotifySlotChanged(FromIndex); NotifySlotChanged(ToIndex); NotifyInventoryChanged(); return true;
+	if(B.IsValid() && A.CanStackWith(B.ItemData.Get()))
+	{
+		B.Quantity += A.Quantity; A=FInventoryItem();
+		NotifySlotChanged(FromIndex); NotifySlotChanged(ToIndex);
+	}
+	else
+	{
+		const bool bHadB=B.IsValid(); Swap(A,B); A.Index=FromIndex; B.Index=ToIndex;
+		NotifySlotMoved(FromIndex,ToIndex); if(bHadB) NotifySlotMoved(ToIndex,FromIndex); else NotifySlotChanged(FromIndex);
+	}
+	NotifyInventoryChanged(); return true;
 }
 bool UInventoryComponent::SwapItems(int32 IndexA, int32 IndexB, AActor* Requestor) { return MoveItem(IndexA, IndexB, Requestor); }
 bool UInventoryComponent::TransferItemToInventory(int32 FromIndex, UInventoryComponent* TargetInventory, AActor* Requestor)
@@ -286,7 +353,7 @@ bool UInventoryComponent::TransferItemToInventory(int32 FromIndex, UInventoryCom
 	if(AActor* O=GetOwner()){ if(!O->HasAuthority()) return TryTransferItem(FromIndex,TargetInventory); }
 	if(!CanModify(Requestor) || !Items.IsValidIndex(FromIndex)) return false;
 
-	FInventoryItem& S=Items[FromIndex]; if(!S.IsValid()) return false;
+	FInventoryItem& S=Items[FromIndex]; if(!S.IsValid() || !CanWithdraw(S,S.Quantity)) return false;
 	UItemDataAsset* D=S.ItemData.Get(); if(!TargetInventory->CanAcceptItem(D)) return false;
 
 	if(int32 TStack=TargetInventory->FindStackableSlot(D); TStack!=INDEX_NONE)
@@ -357,18 +424,20 @@ bool UInventoryComponent::RequestTransferItem(UInventoryComponent* SourceInvento
 		if (O->HasAuthority())
 		{
 			if(!SourceInventory->Items.IsValidIndex(SourceIndex)) return false;
-			FInventoryItem It = SourceInventory->Items[SourceIndex]; if(!It.IsValid()) return false;
+			FInventoryItem It = SourceInventory->Items[SourceIndex]; if(!It.IsValid() || !SourceInventory->CanWithdraw(It,It.Quantity)) return false;
 			if(!TargetInventory->CanAcceptItem(It.ItemData.Get())) return false;
 
 			if(TargetIndex>=0 && TargetInventory->Items.IsValidIndex(TargetIndex) && !TargetInventory->Items[TargetIndex].IsValid())
 			{
 				TargetInventory->Items[TargetIndex] = It; TargetInventory->Items[TargetIndex].Index = TargetIndex;
+				TargetInventory->NotifySlotChanged(TargetIndex);
 				TargetInventory->OnItemAdded.Broadcast(TargetInventory->Items[TargetIndex], TargetInventory->Items[TargetIndex].Quantity);
 			}
 			else
 			{
 				int32 Free = TargetInventory->FindFreeSlot(); if(Free==INDEX_NONE) return false;
 				TargetInventory->Items[Free] = It; TargetInventory->Items[Free].Index = Free;
+				TargetInventory->NotifySlotChanged(Free);
 				TargetInventory->OnItemAdded.Broadcast(TargetInventory->Items[Free], TargetInventory->Items[Free].Quantity);
 			}
 
@@ -421,45 +490,49 @@ bool UInventoryComponent::TrySplitStack(int32 SlotIndex,int32 SplitQuantity)
 // Sorting//
 void UInventoryComponent::SortInventoryByName()
 {
+	UpdateItemIndexes();
 	Items.Sort([](const FInventoryItem& A,const FInventoryItem& B){
 		const UItemDataAsset* AD=A.ItemData.Get(); const UItemDataAsset* BD=B.ItemData.Get();
 		return (AD?AD->GetName():TEXT("")) < (BD?BD->GetName():TEXT(""));
 	});
-	UpdateItemIndexes(); NotifyInventoryChanged();
+	RecordReorder(); NotifyInventoryChanged();
 }
 void UInventoryComponent::ServerSortInventoryByName_Implementation(AController*){ SortInventoryByName(); }
 bool UInventoryComponent::ServerSortInventoryByName_Validate(AController*){ return true; }
 void UInventoryComponent::RequestSortInventoryByName(){ if (AActor* O=GetOwner()) if(!O->HasAuthority()) ServerSortInventoryByName(ResolveRequestorController(O)); else SortInventoryByName(); }
 void UInventoryComponent::SortInventoryByRarity()
 {
+	UpdateItemIndexes();
 	Items.Sort([](const FInventoryItem& A,const FInventoryItem& B){
 		const UItemDataAsset* AD=A.ItemData.Get(); const UItemDataAsset* BD=B.ItemData.Get();
 		const FString AR = AD ? AD->Rarity.ToString() : TEXT(""); const FString BR = BD ? BD->Rarity.ToString() : TEXT("");
 		return AR < BR;
 	});
-	UpdateItemIndexes(); NotifyInventoryChanged();
+	RecordReorder(); NotifyInventoryChanged();
 }
 void UInventoryComponent::ServerSortInventoryByRarity_Implementation(AController*){ SortInventoryByRarity(); }
 bool UInventoryComponent::ServerSortInventoryByRarity_Validate(AController*){ return true; }
 void UInventoryComponent::RequestSortInventoryByRarity(){ if (AActor* O=GetOwner()) if(!O->HasAuthority()) ServerSortInventoryByRarity(ResolveRequestorController(O)); else SortInventoryByRarity(); }
 void UInventoryComponent::SortInventoryByType()
 {
+	UpdateItemIndexes();
 	Items.Sort([](const FInventoryItem& A,const FInventoryItem& B){
 		const UItemDataAsset* AD=A.ItemData.Get(); const UItemDataAsset* BD=B.ItemData.Get();
 		return (AD?AD->ItemType.ToString():TEXT("")) < (BD?BD->ItemType.ToString():TEXT(""));
 	});
-	UpdateItemIndexes(); NotifyInventoryChanged();
+	RecordReorder(); NotifyInventoryChanged();
 }
 void UInventoryComponent::ServerSortInventoryByType_Implementation(AController*){ SortInventoryByType(); }
 bool UInventoryComponent::ServerSortInventoryByType_Validate(AController*){ return true; }
 void UInventoryComponent::RequestSortInventoryByType(){ if (AActor* O=GetOwner()) if(!O->HasAuthority()) ServerSortInventoryByType(ResolveRequestorController(O)); else SortInventoryByType(); }
 void UInventoryComponent::SortInventoryByCategory()
 {
+	UpdateItemIndexes();
 	Items.Sort([](const FInventoryItem& A,const FInventoryItem& B){
 		const UItemDataAsset* AD=A.ItemData.Get(); const UItemDataAsset* BD=B.ItemData.Get();
 		return (AD?AD->ItemCategory.ToString():TEXT("")) < (BD?BD->ItemCategory.ToString():TEXT(""));
 	});
-	UpdateItemIndexes(); NotifyInventoryChanged();
+	RecordReorder(); NotifyInventoryChanged();
 }
 void UInventoryComponent::ServerSortInventoryByCategory_Implementation(AController*){ SortInventoryByCategory(); }
 bool UInventoryComponent::ServerSortInventoryByCategory_Validate(AController*){ return true; }
@@ -483,18 +556,18 @@ void UInventoryComponent::Server_TransferItem_Implementation(UInventoryComponent
 {
 	if(!Source||!Target) return;
 	if(!Source->Items.IsValidIndex(SourceIdx)) return;
-	FInventoryItem It=Source->Items[SourceIdx]; if(!It.IsValid()) return;
+	FInventoryItem It=Source->Items[SourceIdx]; if(!It.IsValid() || !Source->CanWithdraw(It,It.Quantity)) return;
 	if(!Target->CanAcceptItem(It.ItemData.Get())) return;
 
 	if(TargetIdx>=0 && Target->Items.IsValidIndex(TargetIdx) && !Target->Items[TargetIdx].IsValid())
 	{
-		Target->Items[TargetIdx]=It; Target->Items[TargetIdx].Index=TargetIdx;
+		Target->Items[TargetIdx]=It; Target->Items[TargetIdx].Index=TargetIdx; Target->NotifySlotChanged(TargetIdx);
 		Target->OnItemAdded.Broadcast(Target->Items[TargetIdx], Target->Items[TargetIdx].Quantity);
 	}
 	else
 	{
 		int32 Free=Target->FindFreeSlot(); if(Free==INDEX_NONE) return;
-		Target->Items[Free]=It; Target->Items[Free].Index=Free;
+		Target->Items[Free]=It; Target->Items[Free].Index=Free; Target->NotifySlotChanged(Free);
 		Target->OnItemAdded.Broadcast(Target->Items[Free], Target->Items[Free].Quantity);
 	}
 
@@ -508,6 +581,160 @@ bool UInventoryComponent::Server_TransferItem_Validate(UInventoryComponent* Sour
 bool UInventoryComponent::ServerSplitStack_Validate(int32 SlotIndex, int32 SplitQuantity, AController*){ return SlotIndex >= 0 && SplitQuantity > 0; }
 void UInventoryComponent::ServerSplitStack_Implementation(int32 SlotIndex, int32 SplitQuantity, AController* Requestor){ SplitStack(SlotIndex, SplitQuantity, Requestor); }
 
+// Reservations//
+int32 UInventoryComponent::GetAvailableQuantity(FGameplayTag ItemID) const
+{
+	return FMath::Max(0, GetNumItemsOfType(ItemID) - GetReservedQuantity(ItemID));
+}
+bool UInventoryComponent::CanWithdraw(const FInventoryItem& Slot, int32 Quantity) const
+{
+	if(ReservedByTag.Num()==0) return true;
+	const FGameplayTag ItemID=Slot.GetItemIDTag(); if(!ItemID.IsValid()) return true;
+	const int32 Reserved=ReservedByTag.FindRef(ItemID);
+	return Reserved<=0 || GetNumItemsOfType(ItemID)-Quantity >= Reserved;
+}
+bool UInventoryComponent::CanReceive(const TArray<TPair<UItemDataAsset*, int32>>& Stacks) const
+{
+	// Stacks are merged per asset, so each needs at most one new slot.
+	int32 FreeSlots=Items.Num()-GetNumOccupiedSlots();
+	for(const TPair<UItemDataAsset*, int32>& St : Stacks)
+	{
+		if(!CanAcceptItem(St.Key)) return false;
+		if(FindStackableSlot(St.Key)==INDEX_NONE && --FreeSlots<0) return false;
+	}
+	return true;
+}
+void UInventoryComponent::PlaceStacks(const TArray<TPair<UItemDataAsset*, int32>>& Stacks)
+{
+	// Caller checked CanReceive; notifications accumulate until its NotifyInventoryChanged.
+	for(const TPair<UItemDataAsset*, int32>& St : Stacks)
+	{
+		int32 Slot=FindStackableSlot(St.Key);
+		if(Slot!=INDEX_NONE) Items[Slot].Quantity += St.Value;
+		else
+		{
+			Slot=FindFreeSlot();
+			FInventoryItem NewI; NewI.ItemData=St.Key; NewI.Quantity=St.Value; NewI.Index=Slot;
+			Items[Slot]=NewI;
+		}
+		NotifySlotChanged(Slot); OnItemAdded.Broadcast(Items[Slot], St.Value);
+	}
+}
+bool UInventoryComponent::AddItems(const TArray<TPair<UItemDataAsset*, int32>>& Stacks, AActor* Requestor)
+{
+	if(AActor* O=GetOwner()){ if(!O->HasAuthority()) return false; }
+	if(!CanModify(Requestor)) return false;
+
+	TArray<TPair<UItemDataAsset*, int32>> Merged;
+	for(const TPair<UItemDataAsset*, int32>& St : Stacks)
+	{
+		if(!St.Key || St.Value<=0) continue;
+		if(TPair<UItemDataAsset*, int32>* M=Merged.FindByPredicate([&St](const TPair<UItemDataAsset*, int32>& X){ return X.Key==St.Key; })) M->Value += St.Value;
+		else Merged.Add(St);
+	}
+	if(Merged.Num()==0) return false;
+
+	AdjustSlotCountIfNeeded();
+	if(!CanReceive(Merged)) return false;
+
+	PlaceStacks(Merged); NotifyInventoryChanged(); return true;
+}
+int32 UInventoryComponent::ReserveItems(const TArray<FInventoryReservationLine>& Lines)
+{
+	if(AActor* O=GetOwner()){ if(!O->HasAuthority()) return INDEX_NONE; }
+
+	// Merge per tag so repeated lines are checked against their sum.
+	TArray<FInventoryReservationLine> Merged;
+	for(const FInventoryReservationLine& L : Lines)
+	{
+		if(!L.ItemIDTag.IsValid() || L.Quantity<=0) continue;
+		if(FInventoryReservationLine* M=Merged.FindByPredicate([&L](const FInventoryReservationLine& X){ return X.ItemIDTag==L.ItemIDTag; })) M->Quantity += L.Quantity;
+		else Merged.Add(L);
+	}
+	if(Merged.Num()==0) return INDEX_NONE;
+
+	for(const FInventoryReservationLine& M : Merged) if(GetAvailableQuantity(M.ItemIDTag) < M.Quantity) return INDEX_NONE;
+	TArray<FGameplayTag> Changed;
+	for(const FInventoryReservationLine& M : Merged){ ReservedByTag.FindOrAdd(M.ItemIDTag) += M.Quantity; Changed.Add(M.ItemIDTag); }
+
+	const int32 Id=NextReservationId++;
+	Reservations.Add(Id, MoveTemp(Merged));
+	PublishReservations(Changed);
+	return Id;
+}
+void UInventoryComponent::ReleaseReservation(int32 ReservationId)
+{
+	TArray<FInventoryReservationLine> Lines;
+	if(!Reservations.RemoveAndCopyValue(ReservationId, Lines)) return;
+	TArray<FGameplayTag> Changed;
+	for(const FInventoryReservationLine& L : Lines)
+	{
+		int32& R=ReservedByTag.FindOrAdd(L.ItemIDTag); R -= L.Quantity;
+		if(R<=0) ReservedByTag.Remove(L.ItemIDTag);
+		Changed.Add(L.ItemIDTag);
+	}
+	PublishReservations(Changed);
+}
+void UInventoryComponent::PublishReservations(TConstArrayView<FGameplayTag> ChangedTags)
+{
+	ReservedQuantities.Reset(ReservedByTag.Num());
+	for(const TPair<FGameplayTag, int32>& R : ReservedByTag)
+	{
+		FInventoryReservedQuantity& Q=ReservedQuantities.AddDefaulted_GetRef();
+		Q.ItemIDTag=R.Key; Q.Quantity=R.Value;
+	}
+	OnReservationsChanged.Broadcast(this, ChangedTags);
+}
+bool UInventoryComponent::CommitReservation(int32 ReservationId, UInventoryComponent* Target)
+{
+	const TArray<FInventoryReservationLine>* Lines=Reservations.Find(ReservationId);
+	if(!Lines || Target==this) return false;
+
+	// Plan every take first: nothing changes unless the whole reservation is still backed and fits Target.
+	TMap<int32, int32> TakeBySlot;
+	TArray<TPair<UItemDataAsset*, int32>> Stacks;
+	for(const FInventoryReservationLine& L : *Lines)
+	{
+		int32 Remaining=L.Quantity;
+		for(int32 i=0; i<Items.Num() && Remaining>0; ++i)
+		{
+			const FInventoryItem& S=Items[i]; if(!S.IsValid() || S.GetItemIDTag()!=L.ItemIDTag) continue;
+			UItemDataAsset* D=S.ItemData.Get();
+			if(!D){ InventorySyncLoad::FCallSite Site(TEXT("Inventory.CommitReservation")); D=S.ResolveItemData(); }
+			if(!D) continue;
+
+			int32& Taken=TakeBySlot.FindOrAdd(i);
+			const int32 Take=FMath::Min(S.Quantity-Taken, Remaining); if(Take<=0) continue;
+			Taken += Take; Remaining -= Take;
+
+			if(TPair<UItemDataAsset*, int32>* St=Stacks.FindByPredicate([D](const TPair<UItemDataAsset*, int32>& X){ return X.Key==D; })) St->Value += Take;
+			else Stacks.Emplace(D, Take);
+		}
+		if(Remaining>0) return false;
+	}
+	if(Target)
+	{
+		Target->AdjustSlotCountIfNeeded();
+		if(!Target->CanReceive(Stacks)) return false;
+	}
+
+	ReleaseReservation(ReservationId);
+
+	// One batch per inventory: slot notifications accumulate, weight and listeners run once.
+	for(const TPair<int32, int32>& T : TakeBySlot)
+	{
+		if(T.Value<=0) continue;
+		FInventoryItem& S=Items[T.Key]; FInventoryItem Removed=S; Removed.Quantity=T.Value;
+		S.Quantity -= T.Value; if(S.Quantity<=0) S=FInventoryItem();
+		NotifySlotChanged(T.Key); OnItemRemoved.Broadcast(Removed);
+	}
+	if(Target) Target->PlaceStacks(Stacks);
+
+	NotifyInventoryChanged();
+	if(Target) Target->NotifyInventoryChanged();
+	return true;
+}
+
 // Derived state//
 void UInventoryComponent::RecalculateWeightAndVolume()
 {
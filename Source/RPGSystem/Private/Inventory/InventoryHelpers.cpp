@@ -6,6 +6,7 @@
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/ItemDataAsset.h"
 #include "Inventory/InventoryAssetManager.h"
+#include "Inventory/SyncLoadStats.h"
 
 #include "Blueprint/UserWidget.h"
 #include "Kismet/GameplayStatics.h"
@@ -137,6 +138,14 @@ UItemDataAsset* UInventoryHelpers::FindItemDataByTag(UObject* /*WorldContextObje
 
 	if (UInventoryAssetManager* AM = UInventoryAssetManager::GetOptional())
 	{
+		// Resident items are a map lookup; only a cold item reaches the loader.
+		if (UItemDataAsset* Resident = AM->FindItemDataByTag(ItemIDTag))
+		{
+			return Resident;
+		}
+
+		// Blueprint callers have no site of their own; C++ callers name theirs first.
+		InventorySyncLoad::FCallSite Site(TEXT("InventoryHelpers.FindItemDataByTag"));
 		return AM->LoadDataAssetByTag<UItemDataAsset>(ItemIDTag, bSyncLoad);
 	}
 	return nullptr;
@@ -155,6 +164,7 @@ UDataAsset* UInventoryHelpers::LoadDataAssetByTag(UObject* /*WorldContextObject*
 
 	if (UInventoryAssetManager* AM = UInventoryAssetManager::GetOptional())
 	{
+		InventorySyncLoad::FCallSite Site(TEXT("InventoryHelpers.LoadDataAssetByTag"));
 		return AM->LoadDataAssetByTag(Tag, AssetClass, bSyncLoad);
 	}
 	return nullptr;
@@ -1,2 +1,47 @@
 ﻿#include "Inventory/InventoryItem.h"
+#include "Inventory/InventoryAssetManager.h"
+#include "Inventory/ItemResidencySubsystem.h"
+#include "Inventory/SyncLoadStats.h"
 
+UItemDataAsset* FInventoryItem::ResolveItemData() const
+{
+	if (ItemData.IsNull()) return nullptr;
+
+	UItemResidencySubsystem* Residency = IsInGameThread() ? UItemResidencySubsystem::Get() : nullptr;
+	if (!Residency)
+	{
+		return InventorySyncLoad::Load(ItemData, TEXT("InventoryItem.ResolveItemData"));
+	}
+
+	if (UItemDataAsset* Cached = Cast<UItemDataAsset>(Residency->Find(ItemData.ToSoftObjectPath())))
+	{
+		return Cached;
+	}
+
+	UItemDataAsset* Data = InventorySyncLoad::Load(ItemData, TEXT("InventoryItem.ResolveItemData"));
+	Residency->Add(Data);
+	return Data;
+}
+
+FGameplayTag FInventoryItem::GetItemIDTag() const
+{
+	if (const UItemDataAsset* Data = ItemData.Get())
+	{
+		return Data->ItemIDTag;
+	}
+
+	FGameplayTag Tag;
+	if (!ItemData.IsNull() && UInventoryAssetManager::IsInitialized())
+	{
+		if (const UInventoryAssetManager* AM = UInventoryAssetManager::GetOptional())
+		{
+			AM->ResolveItemTagByPath(ItemData.ToSoftObjectPath(), Tag);
+		}
+	}
+	return Tag;
+}
+
+TSharedPtr<FStreamableHandle> FInventoryItem::RequestItemData(FItemDataResolvedDelegate OnResolved) const
+{
+	return UInventoryAssetManager::RequestItemData(ItemData, MoveTemp(OnResolved));
+}
@@ -0,0 +1,37 @@
+// InventoryTagIndexCommandlet.cpp
+#include "Inventory/InventoryTagIndexCommandlet.h"
+#include "Inventory/InventoryAssetManager.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/Parse.h"
+#include "Modules/ModuleManager.h"
+
+UInventoryTagIndexCommandlet::UInventoryTagIndexCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UInventoryTagIndexCommandlet::Main(const FString& Params)
+{
+	UInventoryAssetManager* AM = UInventoryAssetManager::GetOptional();
+	if (!AM)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[Assets] InventoryTagIndex: AssetManagerClassName is not UInventoryAssetManager."));
+		return 1;
+	}
+
+	// Commandlets start before the registry has seen everything.
+	IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AR.SearchAllAssets(/*bSynchronousSearch=*/true);
+
+	FString Output;
+	if (!FParse::Value(*Params, TEXT("Output="), Output))
+	{
+		Output = UInventoryAssetManager::GetTagIndexTablePath();
+	}
+
+	return AM->WriteTagIndexTable(Output) ? 0 : 1;
+}
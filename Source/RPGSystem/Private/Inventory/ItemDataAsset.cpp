@@ -2,6 +2,17 @@
 
 static const FItemAction GNullItemAction; // fallback
 
+const FName UItemDataAsset::BundleUI       = TEXT("UI");
+const FName UItemDataAsset::BundleWorld    = TEXT("World");
+const FName UItemDataAsset::BundleGameplay = TEXT("Gameplay");
+
+const FPrimaryAssetType UItemDataAsset::ItemPrimaryAssetType = TEXT("ItemData");
+
+FPrimaryAssetId UItemDataAsset::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(ItemPrimaryAssetType, GetFName());
+}
+
 const FItemAction* UItemDataAsset::FindAction(const FGameplayTag& ActionTag) const
 {
 	if (!ActionTag.IsValid()) return nullptr;
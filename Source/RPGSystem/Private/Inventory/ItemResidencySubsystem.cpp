@@ -0,0 +1,303 @@
+// ItemResidencySubsystem.cpp
+#include "Inventory/ItemResidencySubsystem.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarResidentBudgetMB(
+	TEXT("Inventory.ResidentBudgetMB"),
+	128.f,
+	TEXT("Memory budget for cached item definitions and recipes, bundles included. Pinned assets count but are never evicted."));
+
+UItemResidencySubsystem* UItemResidencySubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UItemResidencySubsystem>() : nullptr;
+}
+
+void UItemResidencySubsystem::Deinitialize()
+{
+	Entries.Reset();
+	FreeEntries.Reset();
+	EntryByPath.Reset();
+	Pins.Reset();
+	FreePins.Reset();
+	LruHead = LruTail = INDEX_NONE;
+	CachedBytes = 0;
+	Super::Deinitialize();
+}
+
+// --- Entries ---
+int32 UItemResidencySubsystem::FindOrAddEntry(const FSoftObjectPath& Path)
+{
+	if (const int32* Existing = EntryByPath.Find(Path))
+	{
+		return *Existing;
+	}
+
+	const int32 Idx = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+
+	FResidentAsset& E = Entries[Idx];
+	E = FResidentAsset();
+	E.Path   = Path;
+	E.bInUse = true;
+
+	EntryByPath.Add(Path, Idx);
+	return Idx;
+}
+
+void UItemResidencySubsystem::ReleaseEntry(int32 Idx)
+{
+	FResidentAsset& E = Entries[Idx];
+	Unlink(Idx);
+	if (E.Object) CachedBytes -= E.Bytes;
+
+	EntryByPath.Remove(E.Path);
+	E = FResidentAsset();
+	FreeEntries.Add(Idx);
+}
+
+void UItemResidencySubsystem::LinkFront(int32 Idx)
+{
+	FResidentAsset& E = Entries[Idx];
+	if (E.bLinked) return;
+
+	E.Prev = INDEX_NONE;
+	E.Next = LruHead;
+	if (LruHead != INDEX_NONE) Entries[LruHead].Prev = Idx;
+	LruHead = Idx;
+	if (LruTail == INDEX_NONE) LruTail = Idx;
+	E.bLinked = true;
+}
+
+void UItemResidencySubsystem::Unlink(int32 Idx)
+{
+	FResidentAsset& E = Entries[Idx];
+	if (!E.bLinked) return;
+
+	if (E.Prev != INDEX_NONE) Entries[E.Prev].Next = E.Next; else LruHead = E.Next;
+	if (E.Next != INDEX_NONE) Entries[E.Next].Prev = E.Prev; else LruTail = E.Prev;
+	E.Prev = E.Next = INDEX_NONE;
+	E.bLinked = false;
+}
+
+// --- Cache ---
+UObject* UItemResidencySubsystem::Find(const FSoftObjectPath& Path)
+{
+	const int32* Idx = EntryByPath.Find(Path);
+	UObject* Cached = Idx ? Entries[*Idx].Object.Get() : nullptr;
+	if (!Cached)
+	{
+		++Misses;
+		return nullptr;
+	}
+
+	++Hits;
+	if (Entries[*Idx].bLinked)
+	{
+		Unlink(*Idx);
+		LinkFront(*Idx);
+	}
+	return Cached;
+}
+
+void UItemResidencySubsystem::Add(UObject* Asset)
+{
+	if (!Asset) return;
+
+	const int32 Idx = FindOrAddEntry(FSoftObjectPath(Asset));
+	FResidentAsset& E = Entries[Idx];
+
+	// Re-estimated on every add: bundles requested since (World, UI) count from then on.
+	if (E.Object) CachedBytes -= E.Bytes;
+	CachedBytes += Capture(E, Asset);
+
+	if (E.PinCount == 0)
+	{
+		Unlink(Idx);
+		LinkFront(Idx);
+	}
+	Trim();
+}
+
+void UItemResidencySubsystem::Trim()
+{
+	const uint64 Budget = static_cast<uint64>(FMath::Max(0.f, CVarResidentBudgetMB.GetValueOnGameThread()) * 1024.0 * 1024.0);
+	while (CachedBytes > Budget && LruTail != INDEX_NONE)
+	{
+		Evict(LruTail);
+	}
+}
+
+void UItemResidencySubsystem::Evict(int32 Idx)
+{
+	// Only our references: handles other owners hold (bundle requests, pending loads) keep theirs.
+	ReleaseEntry(Idx);
+	++Evictions;
+}
+
+uint64 UItemResidencySubsystem::Capture(FResidentAsset& E, UObject* Asset)
+{
+	E.Object = Asset;
+	E.BundleObjects.Reset();
+	E.Bytes  = Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+
+	const FPrimaryAssetId Id = Asset->GetPrimaryAssetId();
+	if (!Id.IsValid() || !UAssetManager::IsInitialized()) return E.Bytes;
+
+	TArray<FAssetBundleEntry> Bundles;
+	UAssetManager::Get().GetAssetBundleEntries(Id, Bundles);
+	for (const FAssetBundleEntry& Bundle : Bundles)
+	{
+		for (const FTopLevelAssetPath& AssetPath : Bundle.AssetPaths)
+		{
+			if (UObject* Resident = FSoftObjectPath(AssetPath).ResolveObject())
+			{
+				E.BundleObjects.AddUnique(Resident);
+				E.Bytes += Resident->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+			}
+		}
+	}
+	return E.Bytes;
+}
+
+// --- Pins ---
+int32 UItemResidencySubsystem::Pin(const FSoftObjectPath& Path)
+{
+	if (Path.IsNull()) return INDEX_NONE;
+
+	const int32 Idx = FindOrAddEntry(Path);
+	FResidentAsset& E = Entries[Idx];
+	++E.PinCount;
+	Unlink(Idx);
+
+	// Already loaded (by whatever path): hold it from now on.
+	if (!E.Object)
+	{
+		if (UObject* Resident = Path.ResolveObject())
+		{
+			CachedBytes += Capture(E, Resident);
+		}
+	}
+
+	const int32 Handle = FreePins.Num() > 0 ? FreePins.Pop(EAllowShrinking::No) : Pins.AddDefaulted();
+	Pins[Handle] = Idx;
+	return Handle;
+}
+
+void UItemResidencySubsystem::Unpin(int32 PinHandle)
+{
+	if (!Pins.IsValidIndex(PinHandle) || Pins[PinHandle] == INDEX_NONE) return;
+
+	const int32 Idx = Pins[PinHandle];
+	Pins[PinHandle] = INDEX_NONE;
+	FreePins.Add(PinHandle);
+
+	FResidentAsset& E = Entries[Idx];
+	if (--E.PinCount > 0) return;
+
+	if (!E.Object)
+	{
+		// Pinned but never loaded: nothing to cache.
+		ReleaseEntry(Idx);
+		return;
+	}
+
+	LinkFront(Idx);
+	Trim();
+}
+
+// --- Stats ---
+FItemResidencyStats UItemResidencySubsystem::GetStats() const
+{
+	FItemResidencyStats Stats;
+	Stats.Hits      = Hits;
+	Stats.Misses    = Misses;
+	Stats.Evictions = Evictions;
+	Stats.BudgetMB  = CVarResidentBudgetMB.GetValueOnGameThread();
+
+	uint64 PinnedBytes = 0;
+	for (const FResidentAsset& E : Entries)
+	{
+		if (!E.bInUse || !E.Object) continue;
+		++Stats.NumResident;
+		if (E.PinCount > 0)
+		{
+			++Stats.NumPinned;
+			PinnedBytes += E.Bytes;
+		}
+	}
+
+	Stats.ResidentMB = static_cast<float>(CachedBytes / (1024.0 * 1024.0));
+	Stats.PinnedMB   = static_cast<float>(PinnedBytes / (1024.0 * 1024.0));
+	return Stats;
+}
+
+void UItemResidencySubsystem::ResetStats()
+{
+	Hits = Misses = Evictions = 0;
+}
+
+// --- Pin sets ---
+void FItemResidencyPinSet::Sync(TConstArrayView<FSoftObjectPath> Paths)
+{
+	UItemResidencySubsystem* Residency = UItemResidencySubsystem::Get();
+	if (!Residency) return;
+
+	TSet<FSoftObjectPath> Wanted;
+	Wanted.Reserve(Paths.Num());
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (!Path.IsNull()) Wanted.Add(Path);
+	}
+
+	for (auto It = Pinned.CreateIterator(); It; ++It)
+	{
+		if (!Wanted.Contains(It.Key()))
+		{
+			Residency->Unpin(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const FSoftObjectPath& Path : Wanted)
+	{
+		if (!Pinned.Contains(Path))
+		{
+			Pinned.Add(Path, Residency->Pin(Path));
+		}
+	}
+}
+
+void FItemResidencyPinSet::Reset()
+{
+	if (UItemResidencySubsystem* Residency = UItemResidencySubsystem::Get())
+	{
+		for (const TPair<FSoftObjectPath, int32>& It : Pinned)
+		{
+			Residency->Unpin(It.Value);
+		}
+	}
+	Pinned.Reset();
+}
+
+// --- Console ---
+static FAutoConsoleCommand GItemResidencyStatsCmd(
+	TEXT("Inventory.ResidencyStats"),
+	TEXT("Inventory.ResidencyStats [reset] - log item/recipe cache hits, misses, evictions and memory."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		UItemResidencySubsystem* Residency = UItemResidencySubsystem::Get();
+		if (!Residency) return;
+
+		const FItemResidencyStats S = Residency->GetStats();
+		const int64 Lookups = S.Hits + S.Misses;
+		UE_LOG(LogTemp, Log, TEXT("[Assets] Residency: %lld hits, %lld misses (%.1f%% hit), %lld evictions; %d resident (%d pinned), %.2f / %.2f MB (%.2f MB pinned)"),
+			S.Hits, S.Misses, Lookups > 0 ? 100.0 * S.Hits / Lookups : 0.0, S.Evictions,
+			S.NumResident, S.NumPinned, S.ResidentMB, S.BudgetMB, S.PinnedMB);
+
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			Residency->ResetStats();
+		}
+	}));
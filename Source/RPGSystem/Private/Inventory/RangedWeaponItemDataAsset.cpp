@@ -6,5 +6,5 @@
 
 USoundBase* URangedWeaponItemDataAsset::GetFireSoundSync() const
 {
-	return FireSound.IsNull() ? nullptr : FireSound.LoadSynchronous();
+	return IsRunningDedicatedServer() ? nullptr : InventorySyncLoad::Load(FireSound, TEXT("RangedWeaponData.GetFireSoundSync"));
 }
\ No newline at end of file
@@ -0,0 +1,176 @@
+// SyncLoadStats.cpp
+#include "Inventory/SyncLoadStats.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(InventorySyncLoads, true);
+
+static TAutoConsoleVariable<float> CVarSyncLoadEventMs(
+	TEXT("Inventory.SyncLoadEventMs"),
+	5.f,
+	TEXT("Sync loads at least this long are logged and marked as CSV events. 0 disables."));
+
+namespace InventorySyncLoad
+{
+	// How many missed loads the report lists.
+	constexpr int32 HistorySize = 64;
+
+	struct FSiteStats
+	{
+		FName CsvName;
+		FName CsvCountName;
+		int64 Calls = 0;
+		int64 Resident = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+		FSoftObjectPath SlowestAsset;
+	};
+
+	struct FMissedLoad
+	{
+		const TCHAR* Site = nullptr;
+		FSoftObjectPath Path;
+		double Seconds = 0.0;
+		uint64 Frame = 0;
+	};
+
+	struct FState
+	{
+		FCriticalSection Lock;
+
+		/** Keyed by the literal's address; sites are few and fixed. */
+		TMap<const TCHAR*, FSiteStats> Sites;
+
+		TArray<FMissedLoad> History;
+		int32 HistoryNext = 0;
+	};
+
+	static FState& GetState()
+	{
+		static FState State;
+		return State;
+	}
+
+	static thread_local const TCHAR* CurrentCallSite = nullptr;
+
+	FCallSite::FCallSite(const TCHAR* Site)
+		: Previous(CurrentCallSite)
+	{
+		if (!CurrentCallSite) CurrentCallSite = Site;
+	}
+
+	FCallSite::~FCallSite()
+	{
+		CurrentCallSite = Previous;
+	}
+
+	void Record(const TCHAR* Site, const FSoftObjectPath& Path, double Seconds, bool bWasResident)
+	{
+		if (CurrentCallSite) Site = CurrentCallSite;
+
+		FState& State = GetState();
+		{
+			FScopeLock Guard(&State.Lock);
+
+			FSiteStats& S = State.Sites.FindOrAdd(Site);
+			if (S.CsvName.IsNone())
+			{
+				S.CsvName      = FName(Site);
+				S.CsvCountName = FName(FString(Site) + TEXT(".Count"));
+			}
+
+			++S.Calls;
+			if (bWasResident)
+			{
+				++S.Resident;
+				return;
+			}
+
+			S.TotalSeconds += Seconds;
+			if (Seconds > S.MaxSeconds)
+			{
+				S.MaxSeconds   = Seconds;
+				S.SlowestAsset = Path;
+			}
+
+			FMissedLoad Missed{ Site, Path, Seconds, GFrameCounter };
+			if (State.History.Num() < HistorySize)
+			{
+				State.History.Add(MoveTemp(Missed));
+			}
+			else
+			{
+				State.History[State.HistoryNext] = MoveTemp(Missed);
+			}
+			State.HistoryNext = (State.HistoryNext + 1) % HistorySize;
+
+#if CSV_PROFILER
+			// Per frame: milliseconds spent in, and number of, loads that missed at this site.
+			FCsvProfiler::RecordCustomStat(S.CsvName, CSV_CATEGORY_INDEX(InventorySyncLoads), static_cast<float>(Seconds * 1000.0), ECsvCustomStatOp::Accumulate);
+			FCsvProfiler::RecordCustomStat(S.CsvCountName, CSV_CATEGORY_INDEX(InventorySyncLoads), 1, ECsvCustomStatOp::Accumulate);
+#endif
+		}
+
+		const float EventMs = CVarSyncLoadEventMs.GetValueOnAnyThread();
+		if (EventMs > 0.f && Seconds * 1000.0 >= EventMs)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Assets] Sync load %s: %s took %.2f ms"), Site, *Path.ToString(), Seconds * 1000.0);
+			CSV_EVENT(InventorySyncLoads, TEXT("%s %s"), Site, *Path.GetAssetName());
+		}
+	}
+
+	void LogReport()
+	{
+		FState& State = GetState();
+		FScopeLock Guard(&State.Lock);
+
+		TArray<const TPair<const TCHAR*, FSiteStats>*> Sorted;
+		for (const TPair<const TCHAR*, FSiteStats>& It : State.Sites)
+		{
+			Sorted.Add(&It);
+		}
+		Sorted.Sort([](const TPair<const TCHAR*, FSiteStats>& A, const TPair<const TCHAR*, FSiteStats>& B) { return A.Value.TotalSeconds > B.Value.TotalSeconds; });
+
+		UE_LOG(LogTemp, Log, TEXT("[Assets] Sync loads by call site (time spent in loads that missed):"));
+		for (const TPair<const TCHAR*, FSiteStats>* It : Sorted)
+		{
+			const FSiteStats& S = It->Value;
+			const int64 Loads = S.Calls - S.Resident;
+			UE_LOG(LogTemp, Log, TEXT("[Assets]   %-40s %6lld calls, %6lld resident, %6lld loaded: %8.2f ms total, %6.2f ms max (%s)"),
+				It->Key, S.Calls, S.Resident, Loads, S.TotalSeconds * 1000.0, S.MaxSeconds * 1000.0,
+				S.SlowestAsset.IsNull() ? TEXT("-") : *S.SlowestAsset.ToString());
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[Assets] Last %d loads that missed, oldest first:"), State.History.Num());
+		const int32 First = State.History.Num() < HistorySize ? 0 : State.HistoryNext;
+		for (int32 i = 0; i < State.History.Num(); ++i)
+		{
+			const FMissedLoad& M = State.History[(First + i) % State.History.Num()];
+			UE_LOG(LogTemp, Log, TEXT("[Assets]   frame %llu  %-40s %8.2f ms  %s"), M.Frame, M.Site, M.Seconds * 1000.0, *M.Path.ToString());
+		}
+	}
+
+	void Reset()
+	{
+		FState& State = GetState();
+		FScopeLock Guard(&State.Lock);
+		State.Sites.Reset();
+		State.History.Reset();
+		State.HistoryNext = 0;
+	}
+}
+
+static FAutoConsoleCommand GSyncLoadsCmd(
+	TEXT("Inventory.SyncLoads"),
+	TEXT("Inventory.SyncLoads [reset] - log the module's synchronous loads by call site, and the latest loads that missed."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		InventorySyncLoad::LogReport();
+
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			InventorySyncLoad::Reset();
+		}
+	}));
@@ -1,10 +1,17 @@
 ﻿// WorkstationDataAsset.cpp
 #include "Inventory/WorkstationDataAsset.h"
 #include "Crafting/CraftingRecipeDataAsset.h"
+#include "Crafting/RecipeCatalogSubsystem.h"
 
 bool UWorkstationDataAsset::IsRecipeAllowed(const UCraftingRecipeDataAsset* Recipe) const
 {
 	if (!Recipe) return false;
+	if (AllowedRecipes.Num() == 0) return true; // if empty, treat as "allow all"
+
+	if (URecipeCatalogSubsystem* Catalog = URecipeCatalogSubsystem::Get())
+	{
+		return Catalog->IsRecipeAllowed(this, Recipe);
+	}
 
 	for (const TSoftObjectPtr<UCraftingRecipeDataAsset>& Soft : AllowedRecipes)
 	{
@@ -16,5 +23,17 @@ bool UWorkstationDataAsset::IsRecipeAllowed(const UCraftingRecipeDataAsset* Reci
 			}
 		}
 	}
-	return AllowedRecipes.Num() == 0; // if empty, treat as "allow all"
+	return false;
+}
+
+#if WITH_EDITOR
+void UWorkstationDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (URecipeCatalogSubsystem* Catalog = URecipeCatalogSubsystem::Get())
+	{
+		Catalog->InvalidateWorkstation(this);
+	}
 }
+#endif
@@ -2,11 +2,12 @@
 #include "GameplayEffectTypes.h"
 #include "GameplayEffect.h"
 #include "GameplayTagContainer.h"
+#include "Progression/ProgressionTags.h"
 
 UExecCalc_AddSkillXP::UExecCalc_AddSkillXP()
 {
 	// You can change this in the asset if you want (e.g., "Data.Progression.XP")
-	XPSetByCallerTag = FGameplayTag::RequestGameplayTag(TEXT("Data.XP"));
+	XPSetByCallerTag = TAG_Data_XP;
 }
 
 float UExecCalc_AddSkillXP::CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const
@@ -3,3 +3,4 @@
 UE_DEFINE_GAMEPLAY_TAG(TAG_Data_XP,                "Data.XP");
 UE_DEFINE_GAMEPLAY_TAG(TAG_Data_XP_Increment,      "Data.XP.Increment");
 UE_DEFINE_GAMEPLAY_TAG(TAG_Data_XP_CarryRemainder, "Data.XP.CarryRemainder");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Data_XPDelta,           "Data.XPDelta");
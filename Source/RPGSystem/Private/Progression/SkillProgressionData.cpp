@@ -1,12 +1,13 @@
 ﻿// Copyright ...
 #include "Progression/SkillProgressionData.h"
+#include "Progression/ProgressionTags.h"
 
 USkillProgressionData::USkillProgressionData()
 {
 	// Reasonable defaults so the GE can work even if you forget to change the tag.
 	if (!XPDeltaSetByCallerTag.IsValid())
 	{
-		XPDeltaSetByCallerTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Data.XPDelta")), /*ErrorIfNotFound=*/false);
+		XPDeltaSetByCallerTag = TAG_Data_XPDelta;
 	}
 }
 
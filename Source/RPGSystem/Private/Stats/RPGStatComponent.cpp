@@ -5,12 +5,28 @@
 
 
 
-// Define the helper now that the full component is visible.
-void RPGStat_NetPostReplicated(URPGStatComponent* Owner)
+// Define the helpers now that the full component is visible.
+void RPGStat_NetEntriesReplicated(URPGStatComponent* Owner, ERPGStatKind Kind, TConstArrayView<int32> Indices, bool bAdded)
 {
 	if (Owner)
 	{
-		Owner->RebuildCaches();
+		Owner->HandleEntriesReplicated(Kind, Indices, bAdded);
+	}
+}
+
+void RPGStat_NetEntriesRemoved(URPGStatComponent* Owner, ERPGStatKind Kind)
+{
+	if (Owner)
+	{
+		Owner->HandleEntriesRemoved(Kind);
+	}
+}
+
+void RPGStat_NetReceived(URPGStatComponent* Owner, ERPGStatKind Kind)
+{
+	if (Owner)
+	{
+		Owner->HandleReplicationReceived(Kind);
 	}
 }
 
@@ -34,27 +50,147 @@ void URPGStatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 	DOREPLIFETIME(URPGStatComponent, Skills);
 }
 
+namespace RPGStatSlots
+{
+	/** Layout index -> entry index into OutSlots, left empty when they line up. False if an entry isn't in the layout. */
+	template<typename TDef, typename TEntry, typename TFind>
+	bool Map(const TArray<TDef>& Defs, const TArray<TEntry>& Entries, TFind&& FindInLayout, TArray<int32>& OutSlots)
+	{
+		OutSlots.Reset();
+
+		bool bSameOrder = Defs.Num() == Entries.Num();
+		for (int32 i = 0; bSameOrder && i < Entries.Num(); ++i)
+		{
+			bSameOrder = Entries[i].Tag == Defs[i].Tag;
+		}
+		if (bSameOrder) return true;
+
+		OutSlots.Init(INDEX_NONE, Defs.Num());
+		for (int32 i = 0; i < Entries.Num(); ++i)
+		{
+			const int32 LayoutIdx = FindInLayout(Entries[i].Tag);
+			if (LayoutIdx == INDEX_NONE) return false;
+			OutSlots[LayoutIdx] = i;
+		}
+		return true;
+	}
+}
+
+TArray<const UStatSetDataAsset*, TInlineAllocator<8>> URPGStatComponent::GatherStatSets() const
+{
+	TArray<const UStatSetDataAsset*, TInlineAllocator<8>> Sets;
+	for (const UStatSetDataAsset* Set : StatSets)        Sets.Add(Set);
+	for (const UStatSetDataAsset* Set : InitialStatSets) Sets.Add(Set);
+	return Sets;
+}
+
+bool URPGStatComponent::MapSlots(ERPGStatKind Kind)
+{
+	const FRPGStatLayout& L = *Layout;
+	switch (Kind)
+	{
+	case ERPGStatKind::Scalar: return RPGStatSlots::Map(L.Scalars, ScalarStats.Items, [&L](const FGameplayTag& Tag) { return L.FindScalar(Tag); }, ScalarSlots);
+	case ERPGStatKind::Vital:  return RPGStatSlots::Map(L.Vitals,  Vitals.Items,      [&L](const FGameplayTag& Tag) { return L.FindVital (Tag); }, VitalSlots);
+	case ERPGStatKind::Skill:  return RPGStatSlots::Map(L.Skills,  Skills.Items,      [&L](const FGameplayTag& Tag) { return L.FindSkill (Tag); }, SkillSlots);
+	}
+	return false;
+}
+
+bool URPGStatComponent::MapEntriesToLayout()
+{
+	return MapSlots(ERPGStatKind::Scalar) && MapSlots(ERPGStatKind::Vital) && MapSlots(ERPGStatKind::Skill);
+}
+
+void URPGStatComponent::RefreshSlots(TOptional<ERPGStatKind> Kind)
+{
+	// Clients compile the same layout from their own copy of the sets; the server already holds it.
+	if (!Layout.IsValid())
+	{
+		Layout = FRPGStatLayout::Get(GatherStatSets());
+	}
+
+	if (Kind.IsSet())
+	{
+		StaleSlots &= ~KindBit(*Kind);
+		if (MapSlots(*Kind)) return;
+	}
+	else
+	{
+		StaleSlots = 0;
+		if (MapEntriesToLayout()) return;
+	}
+
+	// Entries the local sets don't describe (sets differ from the server's): index what arrived instead.
+	TArray<FGameplayTag> ScalarTags, VitalTags, SkillTags;
+	for (const FRPGScalarEntry& E : ScalarStats.Items) ScalarTags.Add(E.Tag);
+	for (const FRPGVitalEntry&  E : Vitals.Items)      VitalTags .Add(E.Tag);
+	for (const FRPGSkillEntry&  E : Skills.Items)      SkillTags .Add(E.Tag);
+
+	Layout = FRPGStatLayout::FromTags(ScalarTags, VitalTags, SkillTags);
+	StaleSlots = 0;
+	MapEntriesToLayout();
+}
+
 void URPGStatComponent::RebuildCaches()
 {
-	ScalarIndex.Reset();
-	VitalIndex .Reset();
-	SkillIndex .Reset();
+	RefreshSlots();
+
+	for (const FRPGScalarEntry& E : ScalarStats.Items) BroadcastScalar(E);
+	for (const FRPGVitalEntry&  E : Vitals.Items)      BroadcastVital(E);
+	for (const FRPGSkillEntry&  E : Skills.Items)      BroadcastSkill(E);
+}
+
+void URPGStatComponent::BroadcastEntry(ERPGStatKind Kind, int32 Index) const
+{
+	switch (Kind)
+	{
+	case ERPGStatKind::Scalar: if (ScalarStats.Items.IsValidIndex(Index)) BroadcastScalar(ScalarStats.Items[Index]); break;
+	case ERPGStatKind::Vital:  if (Vitals.Items.IsValidIndex(Index))      BroadcastVital (Vitals.Items[Index]);      break;
+	case ERPGStatKind::Skill:  if (Skills.Items.IsValidIndex(Index))      BroadcastSkill (Skills.Items[Index]);      break;
+	}
+}
+
+FGameplayTag URPGStatComponent::GetEntryTag(ERPGStatKind Kind, int32 Index) const
+{
+	switch (Kind)
+	{
+	case ERPGStatKind::Scalar: return ScalarStats.Items.IsValidIndex(Index) ? ScalarStats.Items[Index].Tag : FGameplayTag();
+	case ERPGStatKind::Vital:  return Vitals.Items.IsValidIndex(Index)      ? Vitals.Items[Index].Tag      : FGameplayTag();
+	case ERPGStatKind::Skill:  return Skills.Items.IsValidIndex(Index)      ? Skills.Items[Index].Tag      : FGameplayTag();
+	}
+	return FGameplayTag();
+}
+
+void URPGStatComponent::HandleEntriesReplicated(ERPGStatKind Kind, TConstArrayView<int32> Indices, bool bAdded)
+{
+	// Removals are applied after this callback, so the indices (and any remap made now) may not survive the update:
+	// note the tags and settle both in HandleReplicationReceived. A change alone keeps every entry where it was.
+	if (bAdded) StaleSlots |= KindBit(Kind);
 
-	for (int32 i = 0; i < ScalarStats.Items.Num(); ++i)
+	TArray<FGameplayTag>& Pending = PendingReplicatedTags[static_cast<uint8>(Kind)];
+	for (const int32 Index : Indices)
 	{
-		ScalarIndex.Add(ScalarStats.Items[i].Tag, i);
-		BroadcastScalar(ScalarStats.Items[i]);
+		if (const FGameplayTag Tag = GetEntryTag(Kind, Index); Tag.IsValid()) Pending.AddUnique(Tag);
 	}
-	for (int32 i = 0; i < Vitals.Items.Num(); ++i)
+}
+
+void URPGStatComponent::HandleReplicationReceived(ERPGStatKind Kind)
+{
+	// One remap per update, after adds and removes have both landed.
+	if (!Layout.IsValid() || (StaleSlots & KindBit(Kind)))
 	{
-		VitalIndex.Add(Vitals.Items[i].Tag, i);
-		BroadcastVital(Vitals.Items[i]);
+		RefreshSlots(Kind);
 	}
-	for (int32 i = 0; i < Skills.Items.Num(); ++i)
+
+	TArray<FGameplayTag> Changed = MoveTemp(PendingReplicatedTags[static_cast<uint8>(Kind)]);
+	if (Changed.Num() == 0) return;
+
+	// Indexed before broadcasting, so listeners reading other stats see this update applied.
+	for (const FGameplayTag& Tag : Changed)
 	{
-		SkillIndex.Add(Skills.Items[i].Tag, i);
-		BroadcastSkill(Skills.Items[i]);
+		BroadcastEntry(Kind, FindEntryIdx(Kind, Tag));
 	}
+	OnStatsChanged.Broadcast(Changed);
 }
 
 void URPGStatComponent::BeginPlay()
@@ -62,7 +198,7 @@ void URPGStatComponent::BeginPlay()
 	Super::BeginPlay();
 
 	
-	const bool bShouldInit = bAutoInitializeFromSets && StatSets.Num() > 0;
+	const bool bShouldInit = bAutoInitializeFromSets && (StatSets.Num() > 0 || InitialStatSets.Num() > 0);
 	if (bShouldInit)
 	{
 		const AActor* OwnerActor = GetOwner();
@@ -76,22 +212,80 @@ void URPGStatComponent::BeginPlay()
 }
 
 
-void URPGStatComponent::InitializeFromStatSets(bool bClearExisting )
+void URPGStatComponent::InitializeFromStatSets(bool bClearExisting)
 {
-	
-	if (bClearExisting)
+	const TSharedRef<const FRPGStatLayout> NewLayout = FRPGStatLayout::Get(GatherStatSets());
+
+	// Entries are rebuilt in layout order; kept stats carry their value and replication ID over.
+	TArray<FRPGScalarEntry> NewScalars;
+	NewScalars.Reserve(NewLayout->Scalars.Num());
+	for (const FRPGScalarDef& Def : NewLayout->Scalars)
 	{
-		
+		const int32 Old = bClearExisting ? INDEX_NONE : FindScalarIdx(Def.Tag);
+		if (Old != INDEX_NONE)
+		{
+			NewScalars.Add(ScalarStats.Items[Old]);
+			continue;
+		}
+
+		FRPGScalarEntry& E = NewScalars.AddDefaulted_GetRef();
+		E.Tag   = Def.Tag;
+		E.Value = Def.DefaultValue;
 	}
 
-	for (const UStatSetDataAsset* Set : StatSets)
+	TArray<FRPGVitalEntry> NewVitals;
+	NewVitals.Reserve(NewLayout->Vitals.Num());
+	for (const FRPGVitalDef& Def : NewLayout->Vitals)
 	{
-		if (!Set) continue;
+		const int32 Old = bClearExisting ? INDEX_NONE : FindVitalIdx(Def.Tag);
+		if (Old != INDEX_NONE)
+		{
+			NewVitals.Add(Vitals.Items[Old]);
+			continue;
+		}
 
-		
+		FRPGVitalEntry& E = NewVitals.AddDefaulted_GetRef();
+		E.Tag     = Def.Tag;
+		E.Max     = Def.DefaultMax;
+		E.Current = FMath::Clamp(Def.DefaultCurrent, 0.f, FMath::Max(0.f, Def.DefaultMax));
 	}
 
-	
+	TArray<FRPGSkillEntry> NewSkills;
+	NewSkills.Reserve(NewLayout->Skills.Num());
+	for (const FRPGSkillDef& Def : NewLayout->Skills)
+	{
+		const int32 Old = bClearExisting ? INDEX_NONE : FindSkillIdx(Def.Tag);
+		if (Old != INDEX_NONE)
+		{
+			NewSkills.Add(Skills.Items[Old]);
+			continue;
+		}
+
+		FRPGSkillEntry& E = NewSkills.AddDefaulted_GetRef();
+		E.Tag      = Def.Tag;
+		E.Level    = FMath::Max(0, Def.DefaultLevel);
+		E.XP       = FMath::Max(0.f, Def.DefaultXP);
+		E.XPToNext = FMath::Max(1.f, Def.DefaultXPToNext);
+	}
+
+	ScalarStats.Items = MoveTemp(NewScalars);
+	Vitals     .Items = MoveTemp(NewVitals);
+	Skills     .Items = MoveTemp(NewSkills);
+
+	// New entries need a replication ID; MarkItemDirty on a kept one is harmless.
+	for (FRPGScalarEntry& E : ScalarStats.Items) ScalarStats.MarkItemDirty(E);
+	for (FRPGVitalEntry&  E : Vitals.Items)      Vitals     .MarkItemDirty(E);
+	for (FRPGSkillEntry&  E : Skills.Items)      Skills     .MarkItemDirty(E);
+	ScalarStats.MarkArrayDirty();
+	Vitals     .MarkArrayDirty();
+	Skills     .MarkArrayDirty();
+
+	Layout = NewLayout;
+	ScalarSlots.Reset();
+	VitalSlots .Reset();
+	SkillSlots .Reset();
+
+	RebuildCaches();
 }
 
 
@@ -109,89 +303,123 @@ float URPGStatComponent::GetStat_Implementation(FGameplayTag Tag, float DefaultV
 
 void URPGStatComponent::SetStat_Implementation(FGameplayTag Tag, float NewValue)
 {
-	if (!Tag.IsValid()) return;
+	const FRPGStatDelta Change{ Tag, NewValue };
+	ApplyStatChanges(MakeArrayView(&Change, 1), true);
+}
 
-	// Scalars
-	if (int32 i = FindScalarIdx(Tag); i != INDEX_NONE)
-	{
-		FRPGScalarEntry& E = ScalarStats.Items[i];
-		if (!FMath::IsNearlyEqual(E.Value, NewValue))
-		{
-			E.Value = NewValue;
-			ScalarStats.MarkItemDirty(E);
-			BroadcastScalar(E);
-		}
-		return;
-	}
+void URPGStatComponent::AddToStat_Implementation(FGameplayTag Tag, float Delta)
+{
+	const FRPGStatDelta Change{ Tag, Delta };
+	ApplyStatChanges(MakeArrayView(&Change, 1), false);
+}
 
-	// Vitals (Current)
-	if (int32 i = FindVitalIdx(Tag); i != INDEX_NONE)
+
+// ---------- Batches ----------
+bool URPGStatComponent::FindEntry(const FGameplayTag& Tag, ERPGStatKind& OutKind, int32& OutIndex) const
+{
+	if (int32 i = FindScalarIdx(Tag); i != INDEX_NONE) { OutKind = ERPGStatKind::Scalar; OutIndex = i; return true; }
+	if (int32 i = FindVitalIdx (Tag); i != INDEX_NONE) { OutKind = ERPGStatKind::Vital;  OutIndex = i; return true; }
+	if (int32 i = FindSkillIdx (Tag); i != INDEX_NONE) { OutKind = ERPGStatKind::Skill;  OutIndex = i; return true; }
+	return false;
+}
+
+void URPGStatComponent::ApplyStatChanges(TConstArrayView<FRPGStatDelta> Changes, bool bAbsolute)
+{
+	struct FPending
+	{
+		ERPGStatKind Kind;
+		int32 Index;
+		float Value;
+	};
+
+	// Coalesce first: equipment or a zone often touches the same stat from several sources.
+	TArray<FPending, TInlineAllocator<16>> Pending;
+	for (const FRPGStatDelta& Change : Changes)
 	{
-		FRPGVitalEntry& E = Vitals.Items[i];
-		float NewCur = FMath::Clamp(NewValue, 0.f, FMath::Max(0.f, E.Max));
-		if (!FMath::IsNearlyEqual(E.Current, NewCur))
+		ERPGStatKind Kind;
+		int32 Index;
+		if (!Change.Tag.IsValid() || !FindEntry(Change.Tag, Kind, Index)) continue;
+
+		FPending* P = Pending.FindByPredicate([Kind, Index](const FPending& It) { return It.Kind == Kind && It.Index == Index; });
+		if (!P)
 		{
-			E.Current = NewCur;
-			Vitals.MarkItemDirty(E);
-			BroadcastVital(E);
+			Pending.Add({ Kind, Index, 0.f });
+			P = &Pending.Last();
 		}
-		return;
+		P->Value = bAbsolute ? Change.Value : P->Value + Change.Value;
 	}
 
-	// Skills (Level)
-	if (int32 i = FindSkillIdx(Tag); i != INDEX_NONE)
+	Pending.RemoveAll([this, bAbsolute](const FPending& P) { return !ApplyToEntry(P.Kind, P.Index, P.Value, bAbsolute); });
+	if (Pending.Num() == 0) return;
+
+	// Applied before broadcasting, so listeners reading other stats see the whole batch.
+	TArray<FGameplayTag> Changed;
+	Changed.Reserve(Pending.Num());
+	for (const FPending& P : Pending)
 	{
-		FRPGSkillEntry& E = Skills.Items[i];
-		int32 NewLevel = FMath::Max(0, (int32)FMath::RoundToInt(NewValue));
-		if (E.Level != NewLevel)
-		{
-			E.Level = NewLevel;
-			Skills.MarkItemDirty(E);
-			BroadcastSkill(E);
-		}
+		BroadcastEntry(P.Kind, P.Index);
+		Changed.Add(GetEntryTag(P.Kind, P.Index));
 	}
+	OnStatsChanged.Broadcast(Changed);
 }
 
-void URPGStatComponent::AddToStat_Implementation(FGameplayTag Tag, float Delta)
+bool URPGStatComponent::ApplyToEntry(ERPGStatKind Kind, int32 Index, float Value, bool bAbsolute)
 {
-	if (!Tag.IsValid() || FMath::IsNearlyZero(Delta)) return;
+	if (!bAbsolute && FMath::IsNearlyZero(Value)) return false;
 
+	switch (Kind)
+	{
 	// Scalars
-	if (int32 i = FindScalarIdx(Tag); i != INDEX_NONE)
+	case ERPGStatKind::Scalar:
 	{
-		FRPGScalarEntry& E = ScalarStats.Items[i];
-		E.Value += Delta;
+		FRPGScalarEntry& E = ScalarStats.Items[Index];
+		const float NewValue = bAbsolute ? Value : E.Value + Value;
+		if (FMath::IsNearlyEqual(E.Value, NewValue)) return false;
+
+		E.Value = NewValue;
 		ScalarStats.MarkItemDirty(E);
-		BroadcastScalar(E);
-		return;
+		return true;
 	}
 
 	// Vitals (Current)
-	if (int32 i = FindVitalIdx(Tag); i != INDEX_NONE)
+	case ERPGStatKind::Vital:
 	{
-		FRPGVitalEntry& E = Vitals.Items[i];
-		E.Current = FMath::Clamp(E.Current + Delta, 0.f, FMath::Max(0.f, E.Max));
+		FRPGVitalEntry& E = Vitals.Items[Index];
+		const float NewCur = FMath::Clamp(bAbsolute ? Value : E.Current + Value, 0.f, FMath::Max(0.f, E.Max));
+		if (FMath::IsNearlyEqual(E.Current, NewCur)) return false;
+
+		E.Current = NewCur;
 		Vitals.MarkItemDirty(E);
-		BroadcastVital(E);
-		return;
+		return true;
 	}
 
-	// Skills (XP)
-	if (int32 i = FindSkillIdx(Tag); i != INDEX_NONE)
+	// Skills: absolute sets the Level, a delta goes to XP
+	case ERPGStatKind::Skill:
 	{
-		FRPGSkillEntry& E = Skills.Items[i];
-		E.XP = FMath::Max(0.f, E.XP + Delta);
-
-		// Simple levelling: roll over while XP >= XPToNext
-		while (E.XP >= E.XPToNext)
+		FRPGSkillEntry& E = Skills.Items[Index];
+		if (bAbsolute)
 		{
-			E.XP -= E.XPToNext;
-			E.Level++;
-			E.XPToNext = FMath::Max(1.f, E.XPToNext * 1.15f);
+			const int32 NewLevel = FMath::Max(0, (int32)FMath::RoundToInt(Value));
+			if (E.Level == NewLevel) return false;
+			E.Level = NewLevel;
+		}
+		else
+		{
+			E.XP = FMath::Max(0.f, E.XP + Value);
+
+			// Simple levelling: roll over while XP >= XPToNext
+			while (E.XP >= E.XPToNext)
+			{
+				E.XP -= E.XPToNext;
+				E.Level++;
+				E.XPToNext = FMath::Max(1.f, E.XPToNext * 1.15f);
+			}
 		}
 
 		Skills.MarkItemDirty(E);
-		BroadcastSkill(E);
+		return true;
+	}
 	}
+	return false;
 }
 
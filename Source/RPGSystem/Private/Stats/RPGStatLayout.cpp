@@ -0,0 +1,97 @@
+// RPGStatLayout.cpp
+#include "Stats/RPGStatLayout.h"
+
+#include "UObject/ObjectKey.h"
+
+namespace RPGStatLayouts
+{
+	/** An ordered list of stat sets. */
+	struct FKey
+	{
+		TArray<FObjectKey, TInlineAllocator<4>> Sets;
+
+		bool operator==(const FKey& Other) const { return Sets == Other.Sets; }
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			uint32 Hash = 0;
+			for (const FObjectKey& Set : Key.Sets)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Set));
+			}
+			return Hash;
+		}
+	};
+
+	static TMap<FKey, TSharedRef<const FRPGStatLayout>>& GetCache()
+	{
+		static TMap<FKey, TSharedRef<const FRPGStatLayout>> Cache;
+		return Cache;
+	}
+}
+
+template<typename TDef>
+void FRPGStatLayout::MergeDef(TArray<TDef>& Defs, TMap<FGameplayTag, int32>& Index, const TDef& Def)
+{
+	if (!Def.Tag.IsValid()) return;
+
+	if (const int32* Existing = Index.Find(Def.Tag))
+	{
+		Defs[*Existing] = Def;
+		return;
+	}
+	Index.Add(Def.Tag, Defs.Add(Def));
+}
+
+void FRPGStatLayout::Merge(const UStatSetDataAsset& Set)
+{
+	for (const FRPGScalarDef& Def : Set.Modifiers) MergeDef(Scalars, ScalarIndex, Def);
+	for (const FRPGVitalDef&  Def : Set.Vitals)    MergeDef(Vitals,  VitalIndex,  Def);
+	for (const FRPGSkillDef&  Def : Set.Skills)    MergeDef(Skills,  SkillIndex,  Def);
+}
+
+TSharedRef<const FRPGStatLayout> FRPGStatLayout::Get(TConstArrayView<const UStatSetDataAsset*> Sets)
+{
+	RPGStatLayouts::FKey Key;
+	for (const UStatSetDataAsset* Set : Sets)
+	{
+		if (Set) Key.Sets.Add(FObjectKey(Set));
+	}
+
+	TMap<RPGStatLayouts::FKey, TSharedRef<const FRPGStatLayout>>& Cache = RPGStatLayouts::GetCache();
+	if (const TSharedRef<const FRPGStatLayout>* Cached = Cache.Find(Key))
+	{
+		return *Cached;
+	}
+
+	TSharedRef<FRPGStatLayout> Layout = MakeShared<FRPGStatLayout>();
+	for (const UStatSetDataAsset* Set : Sets)
+	{
+		if (Set) Layout->Merge(*Set);
+	}
+
+	Layout->Scalars.Shrink();
+	Layout->Vitals .Shrink();
+	Layout->Skills .Shrink();
+
+	Cache.Add(MoveTemp(Key), Layout);
+	return Layout;
+}
+
+void FRPGStatLayout::Invalidate(const UStatSetDataAsset* Set)
+{
+	const FObjectKey SetKey(Set);
+	for (auto It = RPGStatLayouts::GetCache().CreateIterator(); It; ++It)
+	{
+		if (It.Key().Sets.Contains(SetKey)) It.RemoveCurrent();
+	}
+}
+
+TSharedRef<const FRPGStatLayout> FRPGStatLayout::FromTags(TConstArrayView<FGameplayTag> ScalarTags, TConstArrayView<FGameplayTag> VitalTags, TConstArrayView<FGameplayTag> SkillTags)
+{
+	TSharedRef<FRPGStatLayout> Layout = MakeShared<FRPGStatLayout>();
+	for (const FGameplayTag& Tag : ScalarTags) { FRPGScalarDef Def; Def.Tag = Tag; MergeDef(Layout->Scalars, Layout->ScalarIndex, Def); }
+	for (const FGameplayTag& Tag : VitalTags)  { FRPGVitalDef  Def; Def.Tag = Tag; MergeDef(Layout->Vitals,  Layout->VitalIndex,  Def); }
+	for (const FGameplayTag& Tag : SkillTags)  { FRPGSkillDef  Def; Def.Tag = Tag; MergeDef(Layout->Skills,  Layout->SkillIndex,  Def); }
+	return Layout;
+}
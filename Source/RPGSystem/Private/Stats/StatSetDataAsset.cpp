@@ -2,4 +2,12 @@
 
 
 #include "Stats/StatSetDataAsset.h"
+#include "Stats/RPGStatLayout.h"
 
+#if WITH_EDITOR
+void UStatSetDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	FRPGStatLayout::Invalidate(this);
+}
+#endif
@@ -5,6 +5,7 @@
 #include "EquipmentSystem/EquipmentHelperLibrary.h"
 #include "Inventory/InventoryHelpers.h"
 #include "Inventory/ItemDataAsset.h"
+#include "Inventory/SyncLoadStats.h"
 
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
@@ -136,6 +137,7 @@ void UEquipmentSlotWidget::UpdateCacheFromEquipment()
 	CurrentItemData = Equipment->GetEquippedItemData(SlotTag);
 	if (!CurrentItemData && CurrentItemIDTag.IsValid())
 	{
+		InventorySyncLoad::FCallSite Site(TEXT("EquipmentSlotWidget.UpdateCacheFromEquipment"));
 		CurrentItemData = UInventoryHelpers::FindItemDataByTag(this, CurrentItemIDTag);
 	}
 
@@ -166,6 +168,7 @@ void UEquipmentSlotWidget::BP_SetCurrentItemIDTag(FGameplayTag InTag, bool bReso
 
 	if (bResolveData && bResolveDataOnTagSet)
 	{
+		InventorySyncLoad::FCallSite Site(TEXT("EquipmentSlotWidget.SetCurrentItemIDTag"));
 		CurrentItemData = InTag.IsValid()
 			? UInventoryHelpers::FindItemDataByTag(this, InTag)
 			: nullptr;
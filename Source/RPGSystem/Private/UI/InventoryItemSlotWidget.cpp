@@ -103,9 +103,7 @@ UItemDataAsset* UInventoryItemSlotWidget::ResolveItemData() const
 	const FInventoryItem Item = InventoryRef->GetItem(SlotIndex);
 	if (Item.ItemData.IsNull()) return nullptr;
 
-	if (UItemDataAsset* Already = Item.ItemData.Get()) return Already;
-
-	return TSoftObjectPtr<UItemDataAsset>(Item.ItemData).LoadSynchronous();
+	return Item.GetResidentItemData();
 }
 
 void UInventoryItemSlotWidget::UpdateFromInventory()
@@ -116,7 +114,20 @@ void UInventoryItemSlotWidget::UpdateFromInventory()
 		return;
 	}
 	const FInventoryItem Item = InventoryRef->GetItem(SlotIndex);
-	SetSlotData(InventoryRef, SlotIndex, ResolveItemData(), Item.Quantity);
+	UItemDataAsset* Data = ResolveItemData();
+	SetSlotData(InventoryRef, SlotIndex, Data, Item.Quantity);
+
+	if (Data || Item.ItemData.IsNull()) return;
+
+	// Cold item: show the quantity now, the data once it streams in (if the slot still holds it).
+	const FSoftObjectPath Expected = Item.ItemData.ToSoftObjectPath();
+	ItemDataLoad = Item.RequestItemData(FItemDataResolvedDelegate::CreateWeakLambda(this, [this, Expected](UItemDataAsset* Loaded)
+	{
+		if (!Loaded || !InventoryRef || SlotIndex == INDEX_NONE) return;
+		if (InventoryRef->GetItem(SlotIndex).ItemData.ToSoftObjectPath() != Expected) return;
+
+		UpdateFromInventory();
+	}));
 }
 
 /* ---------- Input & Drag ---------- */
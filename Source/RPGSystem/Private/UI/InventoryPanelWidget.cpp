@@ -5,6 +5,7 @@
 #include "Components/PanelWidget.h"
 #include "Blueprint/WidgetTree.h"
 
+#include "Inventory/InventoryAssetManager.h"
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/InventoryItem.h"
 #include "Inventory/ItemDataAsset.h"
@@ -81,6 +82,21 @@ void UInventoryPanelWidget::UnbindInventory()
 	InventoryRef->OnInventoryChanged.RemoveAll(this);
 	InventoryRef->OnWeightChanged.RemoveAll(this);
 	InventoryRef->OnVolumeChanged.RemoveAll(this);
+	SlotPins.Reset();
+}
+
+void UInventoryPanelWidget::PinShownItems()
+{
+	if (!InventoryRef) return;
+
+	const int32 UILeaves = InventoryRef->GetNumUISlots();
+	TArray<FSoftObjectPath> Paths;
+	Paths.Reserve(UILeaves);
+	for (int32 i = 0; i < UILeaves; ++i)
+	{
+		Paths.Add(InventoryRef->GetItem(i).ItemData.ToSoftObjectPath());
+	}
+	SlotPins.Sync(Paths);
 }
 
 void UInventoryPanelWidget::EnsureSlotWidgets(int32 DesiredCount)
@@ -118,27 +134,41 @@ void UInventoryPanelWidget::EnsureSlotWidgets(int32 DesiredCount)
 	}
 }
 
-void UInventoryPanelWidget::QuerySlotData(int32 SlotIndex, UItemDataAsset*& OutData, int32& OutQty) const
+bool UInventoryPanelWidget::QuerySlotData(int32 SlotIndex, UItemDataAsset*& OutData, int32& OutQty) const
 {
 	OutData = nullptr; 
 	OutQty = 0;
-	if (!InventoryRef) return;
+	if (!InventoryRef) return true;
 
 	const FInventoryItem Item = InventoryRef->GetItem(SlotIndex);
 	OutQty = Item.Quantity;
 
-	if (!Item.ItemData.IsNull())
+	if (Item.ItemData.IsNull()) return true;
+
+	OutData = Item.GetResidentItemData();
+	return OutData != nullptr;
+}
+
+void UInventoryPanelWidget::StreamSlots(const TArray<int32>& SlotIndices)
+{
+	if (!InventoryRef || SlotIndices.Num() == 0) return;
+
+	TArray<TSoftObjectPtr<UItemDataAsset>> Items;
+	Items.Reserve(SlotIndices.Num());
+	for (const int32 SlotIndex : SlotIndices)
 	{
-		if (UItemDataAsset* Loaded = Item.ItemData.Get())
-		{
-			OutData = Loaded;
-		}
-		else
+		Items.Add(InventoryRef->GetItem(SlotIndex).ItemData);
+	}
+
+	PendingSlotLoad = UInventoryAssetManager::RequestItemDataBatch(Items, FItemDataBatchResolvedDelegate::CreateWeakLambda(this,
+		[this, SlotIndices](const TArray<UItemDataAsset*>& Data)
+	{
+		for (int32 i = 0; i < SlotIndices.Num(); ++i)
 		{
-			TSoftObjectPtr<UItemDataAsset> Soft = Item.ItemData;
-			OutData = Soft.LoadSynchronous();
+			// Failed loads stay empty rather than re-requesting forever.
+			if (Data[i]) RefreshSlot(SlotIndices[i]);
 		}
-	}
+	}));
 }
 
 void UInventoryPanelWidget::RefreshAll()
@@ -150,16 +180,19 @@ void UInventoryPanelWidget::RefreshAll()
 	const int32 UILeaves = InventoryRef->GetNumUISlots();
 	EnsureSlotWidgets(UILeaves);
 
+	TArray<int32> Cold;
 	for (int32 i = 0; i < UILeaves; ++i)
 	{
 		if (UInventoryItemSlotWidget* SlotW = Cast<UInventoryItemSlotWidget>(SlotContainer->GetChildAt(i)))
 		{
 			UItemDataAsset* Data = nullptr; 
 			int32 Qty = 0;
-			QuerySlotData(i, Data, Qty);
+			if (!QuerySlotData(i, Data, Qty)) Cold.Add(i);
 			SlotW->SetSlotData(InventoryRef, i, Data, Qty);
 		}
 	}
+	PinShownItems();
+	StreamSlots(Cold);
 
 	OnFinishedRebuild();
 }
@@ -175,8 +208,10 @@ void UInventoryPanelWidget::RefreshSlot(int32 SlotIndex)
 
 		UItemDataAsset* Data = nullptr; 
 		int32 Qty = 0;
-		QuerySlotData(SlotIndex, Data, Qty);
+		const bool bResident = QuerySlotData(SlotIndex, Data, Qty);
 		SlotW->SetSlotData(InventoryRef, SlotIndex, Data, Qty);
+		PinShownItems();
+		if (!bResident) StreamSlots({ SlotIndex });
 	}
 }
 
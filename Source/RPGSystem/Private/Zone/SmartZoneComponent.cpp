@@ -7,6 +7,7 @@
 #include "EquipmentSystem/EquipmentSystemInterface.h"
 #include "EquipmentSystem/DynamicToolbarComponent.h"
 #include "EquipmentSystem/WieldComponent.h"
+#include "DecaySystem/DecayComponent.h"
 
 USmartZoneComponent::USmartZoneComponent()
 {
@@ -76,12 +77,14 @@ void USmartZoneComponent::RemoveZoneFromActor(AActor* Target)
 void USmartZoneComponent::Apply_Internal(AActor* Target)
 {
 	NotifySystems_Enter(Target);
+	UDecayComponent::NotifyEnvironmentEntered(Target, this, ZoneTags);
 	OnZoneEntered.Broadcast(Target, ZoneTags);
 }
 
 void USmartZoneComponent::Remove_Internal(AActor* Target)
 {
 	NotifySystems_Exit(Target);
+	UDecayComponent::NotifyEnvironmentExited(Target, this);
 	OnZoneExited.Broadcast(Target, ZoneTags);
 }
 
@@ -9,6 +9,7 @@
 class UItemDataAsset;
 class UStaticMeshComponent;
 class UUserWidget;
+struct FStreamableHandle;
 
 UCLASS(Blueprintable)
 class RPGSYSTEM_API ABaseWorldItemActor : public AActor
@@ -70,4 +71,7 @@ protected:
 
 private:
 	void ResolveOwningPCForUI(AActor* Interactor, APlayerController*& OutPC) const;
+
+	/** In game worlds a cold ItemData streams in and re-runs ApplyItemDataVisuals; held to keep it resident. */
+	TSharedPtr<FStreamableHandle> ItemDataLoad;
 };
@@ -2,9 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "Actors/FuelWorkstationActor.h"
+#include "GameplayTagContainer.h"
 #include "CampfireActor.generated.h"
 
 class USphereComponent;
+class UPrimitiveComponent;
 
 UCLASS()
 class RPGSYSTEM_API ACampfireActor : public AFuelWorkstationActor
@@ -14,6 +16,10 @@ class RPGSYSTEM_API ACampfireActor : public AFuelWorkstationActor
 public:
 	ACampfireActor();
 
+	/** True while fuel is actually burning; a banked (paused) fire gives no warmth. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Campfire|Warmth")
+	bool IsWarming() const;
+
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Campfire|Warmth")
 	USphereComponent* WarmthSphere;
@@ -21,7 +27,15 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Campfire|Warmth", meta=(ClampMin="0.0"))
 	float WarmthRadius = 400.f;
 
+	/** Environment tags pushed to DecayComponents inside the warmth radius while burning. Empty = Zone.Climate.Warm. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Campfire|Warmth")
+	FGameplayTagContainer WarmthEnvironmentTags;
+
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual float GetHeatRadius() const override { return WarmthRadius; }
+	virtual FGameplayTagContainer GetHeatEnvironmentTags() const override { return WarmthEnvironmentTags; }
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -29,4 +43,10 @@ protected:
 
 private:
 	void UpdateWarmthRadius();
+	void PushWarmthToOverlapping(bool bWarm);
+
+	UFUNCTION() void OnWarmthBeginOverlap(UPrimitiveComponent* Overlapped, AActor* Other, UPrimitiveComponent* OtherComp, int32 BodyIndex, bool bFromSweep, const FHitResult& Hit);
+	UFUNCTION() void OnWarmthEndOverlap(UPrimitiveComponent* Overlapped, AActor* Other, UPrimitiveComponent* OtherComp, int32 BodyIndex);
+
+	void HandleFuelActiveChanged(bool bActive);
 };
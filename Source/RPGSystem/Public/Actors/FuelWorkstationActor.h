@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "Actors/WorkstationActor.h"
+#include "GameplayTagContainer.h"
 #include "FuelWorkstationActor.generated.h"
 
 class UFuelComponent;
@@ -25,9 +26,29 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Fuel")
 	TObjectPtr<UFuelComponent> FuelComponent;
 
+	// Heat field: radius (cm) this station warms while burning; 0 = not a heat source
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Fuel|Heat", meta=(ClampMin="0.0"))
+	float HeatRadius = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Fuel|Heat", meta=(ClampMin="0.0"))
+	float HeatIntensity = 1.f;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Overridable so subclasses (campfire) can feed the heat field from their own settings
+	virtual float GetHeatRadius() const { return HeatRadius; }
+	virtual FGameplayTagContainer GetHeatEnvironmentTags() const { return FGameplayTagContainer(); }
+
+	/** Re-registers with the heat field after a radius change. */
+	void RefreshHeatSource();
 
 	// Optional: hook for UI; base class already routes to TriggerWorldItemUI
-	
+
+private:
+	int32 HeatSourceHandle = INDEX_NONE;
+
+	/** Follows IsBurnActive(), so a banked fire stops heating until it resumes. */
+	void HandleHeatActiveChanged(bool bActive);
 };
@@ -0,0 +1,116 @@
+// CraftPlannerSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Crafting/CraftingTypes.h"
+#include "CraftPlannerSubsystem.generated.h"
+
+class UCraftingRecipeDataAsset;
+class UInventoryComponent;
+
+/** One job of a plan: craft Recipe Times times. */
+USTRUCT(BlueprintType)
+struct FCraftPlanStep
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TObjectPtr<UCraftingRecipeDataAsset> Recipe = nullptr;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Times = 0;
+};
+
+/** Result of UCraftPlannerSubsystem::PlanCraft. */
+USTRUCT(BlueprintType)
+struct FCraftPlan
+{
+	GENERATED_BODY()
+
+	/** True when Steps can run against the given inventories with nothing missing. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bSuccess = false;
+
+	/** Jobs in dependency order: every step's inputs are produced by earlier steps or already owned. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FCraftPlanStep> Steps;
+
+	/** Raw materials the inventories are short of. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FCraftingItemQuantity> Missing;
+
+	/** Recipes skipped because they take part in a dependency cycle. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<TObjectPtr<UCraftingRecipeDataAsset>> CyclicRecipes;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float PlanMilliseconds = 0.f;
+};
+
+/**
+ * "Craft to target" planning over a recipe dependency graph.
+ *
+ * The graph (output tag -> producing recipes, recipe topological order, cycle flags) and the
+ * cheapest producer per tag are computed once per recipe set; a plan is then a single walk that
+ * draws on owned stock first and expands only the shortfall.
+ *
+ * The recipe set follows URecipeCatalogSubsystem and is rebuilt whenever the catalog is, unless
+ * SetRecipes pinned an explicit set.
+ */
+UCLASS()
+class RPGSYSTEM_API UCraftPlannerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Replaces the planned recipe set and rebuilds the graph; catalog rebuilds no longer override it. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Planner")
+	void SetRecipes(const TArray<UCraftingRecipeDataAsset*>& NewRecipes);
+
+	/** Plans Quantity of TargetItemTag against the combined unreserved contents of Inventories. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Planner")
+	FCraftPlan PlanCraft(FGameplayTag TargetItemTag, int32 Quantity, const TArray<UInventoryComponent*>& Inventories) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Planner")
+	int32 GetNumRecipes() const { return Recipes.Num(); }
+
+private:
+	struct FProducer
+	{
+		int32 Recipe = INDEX_NONE;
+		int32 OutputPerCraft = 0;
+	};
+
+	/** Memoized choice for a tag: the producer with the fewest crafts per unit, including sub-crafts. */
+	struct FTagChoice
+	{
+		int32 Recipe = INDEX_NONE;
+		int32 OutputPerCraft = 0;
+		double CraftsPerUnit = 0.0;
+	};
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UCraftingRecipeDataAsset>> Recipes;
+
+	TMap<FGameplayTag, TArray<FProducer>> ProducersByTag;
+
+	/** Position of each recipe in dependency order (producers before consumers). */
+	TArray<int32> TopoRank;
+	TArray<bool> bInCycle;
+
+	mutable TMap<FGameplayTag, FTagChoice> ChoiceMemo;
+
+	FDelegateHandle CatalogBuiltHandle;
+	bool bExplicitRecipes = false;
+
+	void HandleCatalogBuilt();
+	void RebuildGraph();
+	const FTagChoice* ChooseProducer(const FGameplayTag& Tag, TArray<FGameplayTag>& Visiting) const;
+	void Expand(const FGameplayTag& Tag, int32 Need, TMap<FGameplayTag, int32>& Stock, TMap<int32, int32>& Crafts,
+		TMap<FGameplayTag, int32>& Missing, TArray<FGameplayTag>& Visiting) const;
+};
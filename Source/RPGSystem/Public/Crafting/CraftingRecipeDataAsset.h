@@ -47,4 +47,24 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="XP", meta=(AllowedClasses="XPGrantBundle"))
 	TSoftObjectPtr<UXPGrantBundle> XPGain;
+
+	/**
+	 * Runtime form with item data resolved and quantities/duration validated.
+	 * Built on first use after load and reused for every craft; recipes are immutable at runtime.
+	 * Rebuilt on use while an output's item data is still unresolved.
+	 */
+	const FCompiledRecipe& GetCompiled() const;
+
+	/** Drops the compiled form (editor changes, hot reload). */
+	void InvalidateCompiled() { Compiled = FCompiledRecipe(); }
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	UPROPERTY(Transient)
+	mutable FCompiledRecipe Compiled;
+
+	void Compile() const;
 };
@@ -4,14 +4,18 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Crafting/CraftingTypes.h"
+#include "Inventory/ItemResidencySubsystem.h"
 #include "CraftingStationComponent.generated.h"
 
 class UCraftingRecipeDataAsset;
 class UInventoryComponent;
+class UFuelComponent;
 class AWorkstationActor;
+struct FStreamableHandle;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCraftingStartedSignature, const FCraftingJob&, Job);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FCraftingFinishedSignature, const FCraftingJob&, Job, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FCraftingQueueChangedSignature);
 
 UCLASS(ClassGroup=(RPGSystem), meta=(BlueprintSpawnableComponent))
 class RPGSYSTEM_API UCraftingStationComponent : public UActorComponent
@@ -28,24 +32,67 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Inventories")
 	TObjectPtr<UInventoryComponent> OutputInventory = nullptr;
 
+	// Queue
+	/** Jobs that run at the same time; the rest wait in FIFO order. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Queue", meta=(ClampMin="1"))
+	int32 NumLanes = 1;
+
+	/** Queued + running jobs accepted at once. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Queue", meta=(ClampMin="1"))
+	int32 MaxQueuedJobs = 8;
+
 	// Replicated state
+	/** Unordered on clients; use GetJobs for queue order. */
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|State")
-	FCraftingJob ActiveJob;
+	FCraftingJobList Jobs;
 
+	/** Any job queued or running. */
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|State")
 	bool bIsCrafting = false;
 
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|State")
 	bool bIsPaused = false;
 
+	/** Jobs are halted because the fuel source went out; cleared when it burns again. */
+	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|State")
+	bool bIsFuelStarved = false;
+
+	/** No timers run; progress is settled in closed form by CatchUp. See SetDormant. */
+	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|State")
+	bool bIsDormant = false;
+
+	/** Optional heat source; when set, jobs only progress while it burns. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Fuel")
+	TObjectPtr<UFuelComponent> FuelSource = nullptr;
+
 	/** Resolve recipe inputs/outputs to items by tag at runtime. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="1_Inventory-Crafting|Tags")
 	bool bResolveItemsByTag = true;
 
+	/** What this station offers; matched against recipes' RequiredStationTags by UCraftingStationRegistrySubsystem. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Tags")
+	FGameplayTagContainer StationTags;
+
+	/**
+	 * Opt-in: let UCraftingStationRegistrySubsystem park the station while no player is near and wake it when one
+	 * returns. Parking stops CrafterMustRemain jobs and banks FuelSource (IsCraftingActive is false while dormant),
+	 * so stations whose fuel ignores idleness (bAutoStopBurnWhenIdle off, e.g. campfires) are never auto-parked.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Dormancy")
+	bool bAutoDormancy = false;
+
 	// API
+	/** Stages the inputs and appends a job; it starts as soon as a lane is free. Returns the job id or INDEX_NONE. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Actions")
+	int32 QueueCraft(AActor* InstigatorActor, const UCraftingRecipeDataAsset* Recipe, int32 Times = 1);
+
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Actions")
 	bool StartCraftFromRecipe(AActor* InstigatorActor, const UCraftingRecipeDataAsset* Recipe, int32 Times = 1);
 
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Actions")
+	bool CancelJob(int32 JobId);
+
+	/** Cancels every queued and running job. */
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Actions")
 	void CancelCraft();
 
@@ -55,6 +102,57 @@ public:
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Actions")
 	void ResumeCraft();
 
+	/** Gates crafting on NewFuelSource: the station pauses/resumes on its burn events instead of polling. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Fuel")
+	void SetFuelSource(UFuelComponent* NewFuelSource);
+
+	// Dormancy
+	/**
+	 * Parks the station for when no player is near (or its actor is about to unload): job and fuel
+	 * clocks freeze and no timers run. Elapsed time is settled in one pass by CatchUp, on query or
+	 * on wake; only recipes whose PresencePolicy lets the crafter leave progress in the meantime.
+	 * With bAutoDormancy the station registry drives this from player distance; a station parked
+	 * here by hand is left alone by it.
+	 */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Dormancy")
+	void SetDormant(bool bDormant);
+
+	/** Settles a dormant station up to now and delivers everything that finished in one batch. Returns jobs completed. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Dormancy")
+	int32 CatchUp();
+
+	/** Goes dormant and captures the queue so it can be restored after the actor reloads. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Dormancy")
+	FCraftingStationSnapshot MakeSnapshot();
+
+	/** Replaces the queue with Snapshot, catches up the time since it was taken (or ElapsedSeconds if >= 0) and wakes. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Dormancy")
+	int32 RestoreSnapshot(const FCraftingStationSnapshot& Snapshot, float ElapsedSeconds = -1.f);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Queries")
+	bool IsDormant() const { return bIsDormant; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Queries")
+	bool IsCraftingInProgress() const { return bIsCrafting; }
+
+	/** Jobs in queue order on server and clients (JobIds are handed out in FIFO order). */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Queries")
+	TArray<FCraftingJob> GetJobs() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Queries")
+	bool HasFreeLane() const;
+
+	/** Seconds until the job completes at the current state (frozen while halted or dormant, full duration while queued). */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Queries")
+	float GetJobRemainingSeconds(int32 JobId) const;
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Tags")
+	void SetStationTags(const FGameplayTagContainer& NewTags);
+
+	/** Call after the owning actor moves so nearby-station queries see the new location. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Utility")
+	void RefreshStationRegistration();
+
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Utility")
 	void GatherOwnedTagsFromActor(AActor* Viewer, FGameplayTagContainer& Out) const;
 
@@ -65,20 +163,89 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="1_Inventory-Crafting|Events")
 	FCraftingFinishedSignature OnCraftFinished;
 
+	/** Queue contents changed (server and clients). */
+	UPROPERTY(BlueprintAssignable, Category="1_Inventory-Crafting|Events")
+	FCraftingQueueChangedSignature OnJobsChanged;
+
+	/** Called from FCraftingJobList after a replicated update. */
+	void HandleJobsReplicated();
+
 protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
-	/** Finishes the current craft tick. */
-	void FinishCraft_Internal();
+	/** Completes every running job whose EndTime has passed, then refills lanes. */
+	void FinishDueJobs();
+
+	/** Advances a dormant station by ElapsedSeconds in closed form: lane schedule, fuel cut-off, one delivery. */
+	int32 SimulateElapsed(float ElapsedSeconds);
 
 	// Inventory hooks
-	bool MoveRequiredToInput(const UCraftingRecipeDataAsset* Recipe, int32 Times, AActor* InstigatorActor);
-	void DeliverOutputs(const UCraftingRecipeDataAsset* Recipe);
+	/** First phase: holds Times x the recipe's inputs in the crafter's inventory and records the reservation on Job. */
+	bool ReserveInputs(const UCraftingRecipeDataAsset* Recipe, int32 Times, AActor* InstigatorActor, FCraftingJob& Job);
+
+	/** Second phase: moves a reservation into InputInventory in one batch; releases it on failure. */
+	bool CommitInputs(UInventoryComponent* Source, int32 ReservationId);
+	void ReleaseInputs(const FCraftingJob& Job);
+	/** Output items are resolved from their soft paths; they were streamed in while the job ran (see NotifyJobsChanged). */
+	void DeliverOutputs(const UCraftingRecipeDataAsset* Recipe, int32 Times);
+
+	/** All outputs of Finished as one OutputInventory transaction; falls back to DeliverOutputs if they don't fit. */
+	void DeliverJobOutputs(const TArray<FCraftingJob>& Finished);
 	void GiveFinishXPIIfAny(const UCraftingRecipeDataAsset* Recipe, AActor* InstigatorActor, bool bSuccess);
 
 private:
+	/** One-shot, set for the earliest running EndTime; cleared while idle or halted. */
 	FTimerHandle CraftTimerHandle;
 
+	int32 NextJobId = 0;
+
+	/** Handle in UCraftingStationRegistrySubsystem. */
+	int32 RegistryHandle = INDEX_NONE;
+
+	/** Server time a dormant station was last settled up to. */
+	float DormantSince = 0.f;
+
+	/** Recipes of queued and running jobs, and their output items, stay cached until their job ends. */
+	FItemResidencyPinSet RecipePins;
+
+	/** Server: streams in output items of queued jobs that aren't resident yet, so delivery never blocks. */
+	TSharedPtr<FStreamableHandle> OutputItemsLoad;
+
+	/** Re-pins the recipes in Jobs and their outputs, then broadcasts OnJobsChanged. */
+	void NotifyJobsChanged();
+
+	/** A job's reservation, detached from it while being committed. */
+	struct FPendingCommit
+	{
+		int32 JobId;
+		TWeakObjectPtr<UInventoryComponent> Source;
+		int32 ReservationId;
+	};
+
+	/** Commits each reservation into InputInventory; jobs whose commit fails are removed and returned. */
+	void CommitPending(TArrayView<const FPendingCommit> Pending, TArray<int32>& OutCommittedIds, TArray<FCraftingJob>& OutFailed);
+	void BroadcastFailed(const TArray<FCraftingJob>& Failed);
+
+	/** Dormancy: the station takes custody of the inputs of every queued job still holding a reservation. */
+	void StageReservedInputs();
+
+	static bool ProgressesWhileDormant(const FCraftingJob& Job);
+
+	void HandleFuelActiveChanged(bool bActive);
+
+	/** Gives free lanes to queued jobs in FIFO order; a job whose reserved inputs can't be staged fails. */
+	void StartQueuedJobs();
+
+	/** Starts or freezes every started job's clock to match bIsPaused / bIsFuelStarved. */
+	void UpdateJobClock();
+	void ScheduleWakeup();
+
+	/** Refreshes bIsCrafting and tells the fuel source when the station goes busy or idle. */
+	void UpdateCraftingState();
+	float GetServerTimeSeconds() const;
+
 	bool HasAuth() const
 	{
 		const AActor* Owner = GetOwner();
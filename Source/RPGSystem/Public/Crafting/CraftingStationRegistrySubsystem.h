@@ -0,0 +1,90 @@
+// CraftingStationRegistrySubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "CraftingStationRegistrySubsystem.generated.h"
+
+class UCraftingStationComponent;
+class UCraftingRecipeDataAsset;
+
+/** One registered station: where it stands and what it offers. */
+struct FRegisteredStation
+{
+	TWeakObjectPtr<UCraftingStationComponent> Station;
+	FVector Location = FVector::ZeroVector;
+	FGameplayTagContainer Tags;
+	FIntPoint Cell = FIntPoint::ZeroValue;
+	bool bInUse = false;
+
+	/** Parked by the proximity sweep (not by a SetDormant caller), so the sweep may wake it. */
+	bool bAutoDormant = false;
+};
+
+/**
+ * Spatial index of every UCraftingStationComponent in the world.
+ * Stations are points in a uniform XY grid and carry their StationTags, so "stations satisfying
+ * these RequiredStationTags within R" only tests the stations in the cells the radius covers,
+ * without iterating actors or relying on overlaps. Stations register themselves on BeginPlay.
+ *
+ * On the server the same grid drives dormancy: a low-frequency sweep parks bAutoDormancy stations
+ * with no player pawn nearby and wakes them when one comes back.
+ */
+UCLASS()
+class RPGSYSTEM_API UCraftingStationRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// --- Stations ---
+	int32 RegisterStation(UCraftingStationComponent* Station);
+	void UnregisterStation(int32 Handle);
+
+	/** Re-reads the station's location and tags, e.g. after it moved or its StationTags changed. */
+	void UpdateStation(int32 Handle);
+
+	// --- Queries ---
+	/** Stations within Radius of Location whose tags include all of RequiredTags, nearest first. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Stations")
+	void FindStations(const FVector& Location, float Radius, const FGameplayTagContainer& RequiredTags,
+		TArray<UCraftingStationComponent*>& OutStations) const;
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Stations")
+	UCraftingStationComponent* FindNearestStation(const FVector& Location, float Radius, const FGameplayTagContainer& RequiredTags) const;
+
+	/** FindStations with the recipe's RequiredStationTags. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Stations")
+	void FindStationsForRecipe(const FVector& Location, float Radius, const UCraftingRecipeDataAsset* Recipe,
+		TArray<UCraftingStationComponent*>& OutStations) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Stations")
+	int32 GetNumStations() const { return Stations.Num() - FreeStations.Num(); }
+
+private:
+	TArray<FRegisteredStation> Stations;
+	TArray<int32> FreeStations;
+
+	/** Cell -> handles of the stations standing in it. */
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	/** Registered stations per tag; a required tag nobody offers answers a query without touching the grid. */
+	TMap<FGameplayTag, int32> TagCounts;
+
+	FTimerHandle DormancyTimerHandle;
+
+	/** Parks stations with no player within the sleep radius, wakes parked ones with a player within the wake radius. */
+	void UpdateDormancy();
+
+	static FIntPoint CellOf(const FVector& Point);
+	void Link(int32 Handle, bool bLink);
+	bool AnyStationOffers(const FGameplayTagContainer& RequiredTags) const;
+
+	/** Calls Visitor(Station, DistSq) for every live station in range that satisfies RequiredTags. */
+	template<typename FVisitor>
+	void ForEachStationInRange(const FVector& Location, float Radius, const FGameplayTagContainer& RequiredTags, FVisitor&& Visitor) const;
+};
@@ -4,11 +4,17 @@
 #include "CoreMinimal.h"
 #include "Inventory/ItemDataAsset.h"
 #include "GameplayTagContainer.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "CraftingTypes.generated.h"
 
 class UCraftingRecipeDataAsset;
+class UCraftingStationComponent;
+class UInventoryComponent;
 class AActor;
 
+/** Free helper used by FCraftingJobList PostReplicated* callbacks (defined in CraftingStationComponent.cpp). */
+RPGSYSTEM_API void RPGCrafting_NetPostReplicated(UCraftingStationComponent* Owner);
+
 /** How present the crafter must be for a job. */
 UENUM(BlueprintType)
 enum class ECraftPresencePolicy : uint8
@@ -41,12 +47,52 @@ struct FCraftItemOutput : public FCraftingItemQuantity
 {
 	GENERATED_BODY()
 };
-/** One in-flight crafting job. */
+/** A recipe line with its item data resolved once. */
+USTRUCT()
+struct FCompiledRecipeItem
+{
+	GENERATED_BODY()
+
+	/** Soft, so compiled recipes (and the catalog holding them) don't keep every item loaded; see UCraftingStationComponent::DeliverOutputs. */
+	UPROPERTY() TSoftObjectPtr<UItemDataAsset> Item;
+	UPROPERTY() FGameplayTag ItemIDTag;
+	UPROPERTY() int32 Quantity = 0;
+};
+
+/** Runtime form of a UCraftingRecipeDataAsset; see UCraftingRecipeDataAsset::GetCompiled. */
+USTRUCT()
+struct FCompiledRecipe
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<FCompiledRecipeItem> Inputs;
+	UPROPERTY() TArray<FCompiledRecipeItem> Outputs;
+	UPROPERTY() float CraftSeconds = 0.01f;
+	UPROPERTY() FGameplayTagContainer RequiredStationTags;
+	UPROPERTY() FGameplayTag UnlockTag;
+
+	UPROPERTY() bool bCompiled = false;
+
+	/** An input's or output's item couldn't be resolved yet (e.g. compiled before the tag index); GetCompiled retries. */
+	UPROPERTY() bool bUnresolvedItems = false;
+
+	float GetDurationSeconds(int32 Times) const { return CraftSeconds * FMath::Max(1, Times); }
+};
+
+/** One queued or in-flight crafting job. */
 USTRUCT(BlueprintType)
-struct FCraftingJob
+struct FCraftingJob : public FFastArraySerializerItem
 {
 	GENERATED_BODY()
 
+	/** Station-unique id, stable while the job is queued or running. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 JobId = INDEX_NONE;
+
+	/** Lane the job runs in; INDEX_NONE while it waits in the queue. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Lane = INDEX_NONE;
+
 	/** Recipe being crafted. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TObjectPtr<UCraftingRecipeDataAsset> Recipe = nullptr;
@@ -59,11 +105,72 @@ struct FCraftingJob
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	int32 Count = 1;
 
-	/** Server time when job started. */
+	/** Server time when job got a lane. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	float StartTime = 0.f;
 
-	/** Server time when job should complete. */
+	/** Server time when job should complete; -1 while queued or halted (paused or out of fuel). */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	float EndTime   = 0.f;
+
+	/** Craft seconds still owed; authoritative only while halted. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float RemainingSeconds = 0.f;
+
+	/** Server only: inventory holding this job's inputs on reservation until it gets a lane. */
+	UPROPERTY(NotReplicated)
+	TWeakObjectPtr<UInventoryComponent> ReservedFrom;
+
+	UPROPERTY(NotReplicated)
+	int32 ReservationId = INDEX_NONE;
+
+	bool IsStarted() const { return Lane != INDEX_NONE; }
+	bool IsRunning() const { return EndTime >= 0.f; }
+};
+
+/**
+ * A station's jobs. The server keeps Items in FIFO order (started jobs keep their queue position),
+ * but fast-array replication does not preserve order on clients: read the queue through
+ * UCraftingStationComponent::GetJobs, which orders by JobId.
+ */
+USTRUCT(BlueprintType)
+struct FCraftingJobList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FCraftingJob> Items;
+
+	UCraftingStationComponent* Owner = nullptr;
+	void Register(UCraftingStationComponent* InOwner) { Owner = InOwner; }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FCraftingJob, FCraftingJobList>(Items, DeltaParms, *this);
+	}
+
+	// Once per received bunch, after adds/changes/removes are all applied.
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters&) { RPGCrafting_NetPostReplicated(Owner); }
+};
+template<> struct TStructOpsTypeTraits<FCraftingJobList> : public TStructOpsTypeTraitsBase2<FCraftingJobList> { enum { WithNetDeltaSerializer = true, WithNetSharedSerialization = true }; };
+
+/** A dormant station's queue, kept while its actor is unloaded; see UCraftingStationComponent::MakeSnapshot. */
+USTRUCT(BlueprintType)
+struct FCraftingStationSnapshot
+{
+	GENERATED_BODY()
+
+	/** Frozen jobs: RemainingSeconds is authoritative, inputs are already staged. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FCraftingJob> Jobs;
+
+	/** Server time the queue was settled up to. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float SavedServerTime = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NextJobId = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bPaused = false;
 };
@@ -0,0 +1,108 @@
+// RecipeAvailabilityComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "RecipeAvailabilityComponent.generated.h"
+
+class UCraftingRecipeDataAsset;
+class UInventoryComponent;
+struct FInventoryDelta;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRecipeAvailabilityChangedSignature, const UCraftingRecipeDataAsset*, Recipe, int32, MaxCraftCount);
+
+/**
+ * Keeps "what can I craft, and how many times" current for a player or station.
+ *
+ * Recipes are indexed by the ItemIDTags they consume; source inventories push slot deltas and
+ * reservation changes (on clients too), so a change only re-counts the tags it touched and the
+ * recipes that read those tags. Totals are what the inventories can actually give up
+ * (GetAvailableQuantity): quantity reserved by queued crafts doesn't make a recipe craftable.
+ * UI lists read the cached counts instead of scanning inventories per recipe.
+ */
+UCLASS(ClassGroup=(RPGSystem), meta=(BlueprintSpawnableComponent))
+class RPGSYSTEM_API URecipeAvailabilityComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	URecipeAvailabilityComponent();
+
+	/** Recipes to track. Change at runtime via SetRecipes. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Availability")
+	TArray<TObjectPtr<UCraftingRecipeDataAsset>> Recipes;
+
+	/** Adds the owner's own inventory as a source on BeginPlay. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Availability")
+	bool bTrackOwnerInventory = true;
+
+	/** Cap for reported counts (and the count of recipes without inputs). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Inventory-Crafting|Availability", meta=(ClampMin="1"))
+	int32 MaxReportedCount = 999;
+
+	/** Fired for each recipe whose max craft count changed. */
+	UPROPERTY(BlueprintAssignable, Category="1_Inventory-Crafting|Events")
+	FRecipeAvailabilityChangedSignature OnRecipeAvailabilityChanged;
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Availability")
+	void SetRecipes(const TArray<UCraftingRecipeDataAsset*>& NewRecipes);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Availability")
+	void AddSourceInventory(UInventoryComponent* Inventory);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Availability")
+	void RemoveSourceInventory(UInventoryComponent* Inventory);
+
+	/** How many times Recipe can be crafted from all sources combined (0 if untracked). */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Availability")
+	int32 GetMaxCraftCount(const UCraftingRecipeDataAsset* Recipe) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Crafting|Availability")
+	bool IsCraftable(const UCraftingRecipeDataAsset* Recipe) const { return GetMaxCraftCount(Recipe) > 0; }
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Availability")
+	void GetCraftableRecipes(TArray<UCraftingRecipeDataAsset*>& OutRecipes) const;
+
+	/** Combined available quantity of ItemIDTag across sources; only tags some tracked recipe consumes are counted. */
+	int32 GetTrackedQuantity(const FGameplayTag& ItemIDTag) const { return TotalByTag.FindRef(ItemIDTag); }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/** Per-slot (tag, quantity) as last seen, so a delta can be turned into the tags it touched. */
+	struct FSourceState
+	{
+		TWeakObjectPtr<UInventoryComponent> Inventory;
+		TArray<TPair<FGameplayTag, int32>> Slots;
+	};
+
+	/** A recipe's inputs, merged per tag. */
+	struct FRecipeNeeds
+	{
+		TArray<TPair<FGameplayTag, int32>> PerTag;
+	};
+
+	TArray<FSourceState> Sources;
+	TArray<FRecipeNeeds> Needs;
+	TArray<int32> MaxCounts;
+
+	/** Inverted index: input tag -> tracked recipe indices. */
+	TMap<FGameplayTag, TArray<int32>> RecipesByInput;
+	TMap<FGameplayTag, int32> TotalByTag;
+	TMap<const UCraftingRecipeDataAsset*, int32> RecipeIndex;
+
+	void RebuildIndex();
+	void HandleInventoryDelta(UInventoryComponent* Inventory, const FInventoryDelta& Delta);
+	void HandleReservationsChanged(UInventoryComponent* Inventory, TConstArrayView<FGameplayTag> ItemIDTags);
+	void BindSource(UInventoryComponent* Inventory, bool bBind);
+
+	TPair<FGameplayTag, int32> ReadSlot(const UInventoryComponent* Inventory, int32 SlotIndex) const;
+	void ApplySlot(FSourceState& Source, int32 SlotIndex, TArray<FGameplayTag>& OutDirtyTags);
+	void ResyncSource(FSourceState& Source, TArray<FGameplayTag>& OutDirtyTags);
+	void RefreshTotals(const TArray<FGameplayTag>& DirtyTags);
+	void RecomputeRecipes(const TArray<FGameplayTag>& DirtyTags);
+	int32 ComputeMaxCount(int32 RecipeIdx) const;
+};
@@ -0,0 +1,119 @@
+// RecipeCatalogSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "RecipeCatalogSubsystem.generated.h"
+
+class UCraftingRecipeDataAsset;
+class UWorkstationDataAsset;
+struct FStreamableHandle;
+
+DECLARE_MULTICAST_DELEGATE(FOnRecipeCatalogBuilt);
+
+/**
+ * Every UCraftingRecipeDataAsset in the project, loaded once and indexed by RecipeIDTag,
+ * Discipline, required station tag, UnlockTag and output item.
+ *
+ * Workstation AllowedRecipes lists are resolved against the catalog on first use (by soft path,
+ * no loads) into a hashed set plus a ready-made list, so station filtering is a lookup instead of a
+ * walk over soft pointers. Engine-wide because recipes and workstations are assets, not world state.
+ *
+ * The build is always async and queries never wait for it: until IsBuilt(), lookups come back empty
+ * and IsRecipeAllowed falls back to a path compare. Listen to OnCatalogBuilt for the finished index.
+ */
+UCLASS()
+class RPGSYSTEM_API URecipeCatalogSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static URecipeCatalogSubsystem* Get();
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Starts the batched async load of every recipe; also called from UInventoryAssetManager::StartInitialLoading. */
+	void Preload();
+
+	/** False until the preload finishes; queries before that return empty results instead of blocking. */
+	bool IsBuilt() const { return bBuilt; }
+
+	/** Drops the index, station caches and pending load, then starts a fresh async build. */
+	void Invalidate();
+
+	/** Fires after every (re)build, on the game thread. */
+	FOnRecipeCatalogBuilt OnCatalogBuilt;
+
+	/** Drops one workstation's resolved list, e.g. after its AllowedRecipes changed. */
+	void InvalidateWorkstation(const UWorkstationDataAsset* Workstation);
+
+	// Lookups
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Catalog")
+	UCraftingRecipeDataAsset* FindRecipe(FGameplayTag RecipeIDTag);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Catalog")
+	void GetRecipesByDiscipline(FGameplayTag Discipline, TArray<UCraftingRecipeDataAsset*>& OutRecipes);
+
+	/** Recipes whose RequiredStationTags contain StationTag. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Catalog")
+	void GetRecipesForStationTag(FGameplayTag StationTag, TArray<UCraftingRecipeDataAsset*>& OutRecipes);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Catalog")
+	void GetRecipesByUnlockTag(FGameplayTag UnlockTag, TArray<UCraftingRecipeDataAsset*>& OutRecipes);
+
+	/** Recipes listing ItemIDTag among their outputs. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Catalog")
+	void GetRecipesProducing(FGameplayTag ItemIDTag, TArray<UCraftingRecipeDataAsset*>& OutRecipes);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Catalog")
+	void GetAllRecipes(TArray<UCraftingRecipeDataAsset*>& OutRecipes);
+
+	// Workstations
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Catalog")
+	bool IsRecipeAllowed(const UWorkstationDataAsset* Workstation, const UCraftingRecipeDataAsset* Recipe);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Crafting|Catalog")
+	void GetRecipesForWorkstation(const UWorkstationDataAsset* Workstation, TArray<UCraftingRecipeDataAsset*>& OutRecipes);
+
+	/** C++: the cached list itself, valid until the catalog or the workstation is invalidated. */
+	const TArray<UCraftingRecipeDataAsset*>& GetWorkstationRecipes(const UWorkstationDataAsset* Workstation);
+
+private:
+	/** A workstation's AllowedRecipes, resolved against the catalog. */
+	struct FWorkstationRecipes
+	{
+		TSet<const UCraftingRecipeDataAsset*> Allowed;
+		TArray<UCraftingRecipeDataAsset*> List;
+
+		/** Empty AllowedRecipes means every recipe. */
+		bool bAllowAll = false;
+	};
+
+	/** Keeps the indexed recipes loaded. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UCraftingRecipeDataAsset>> Recipes;
+
+	TMap<FGameplayTag, int32> ById;
+	TMap<FSoftObjectPath, int32> ByPath;
+	TMap<FGameplayTag, TArray<int32>> ByDiscipline;
+	TMap<FGameplayTag, TArray<int32>> ByStationTag;
+	TMap<FGameplayTag, TArray<int32>> ByUnlockTag;
+	TMap<FGameplayTag, TArray<int32>> ByOutput;
+
+	TMap<TObjectKey<UWorkstationDataAsset>, FWorkstationRecipes> WorkstationCache;
+
+	TArray<FSoftObjectPath> RecipePaths;
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	bool bBuilt = false;
+
+	void RequestLoad();
+	void HandleFilesLoaded();
+	bool EnsureBuilt();
+	void ResetIndex();
+	void BuildIndex();
+	const FWorkstationRecipes& ResolveWorkstation(const UWorkstationDataAsset* Workstation);
+	void Collect(const TArray<int32>* Indices, TArray<UCraftingRecipeDataAsset*>& OutRecipes) const;
+};
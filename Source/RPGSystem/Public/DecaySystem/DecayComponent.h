@@ -8,7 +8,11 @@
 
 class UInventoryComponent;
 class UItemDataAsset;
+class UDecayProfileDataAsset;
+class UDecaySubsystem;
 struct FInventoryItem;
+struct FInventoryDelta;
+struct FDecayCompletion;
 
 USTRUCT(BlueprintType)
 struct FDecaySlot
@@ -27,6 +31,30 @@ struct FDecaySlot
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	int32 BatchSize = 1;
 
+	/** Storage speed x environment modifiers currently applied to this slot. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float RateMultiplier = 1.f;
+
+	/** Server world time this batch completes at the current rate; -1 while stalled. Clients extrapolate from it. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float ExpireServerTime = -1.f;
+
+	/** Environment part of RateMultiplier (server only). */
+	UPROPERTY(NotReplicated)
+	float EnvironmentMultiplier = 1.f;
+
+	/** Item being tracked; a different item landing in the slot restarts tracking (server only). */
+	UPROPERTY(NotReplicated)
+	FGameplayTag ItemIDTag;
+
+	/** Item tags matched against environment filters (server only). */
+	UPROPERTY(NotReplicated)
+	FGameplayTagContainer ItemTags;
+
+	/** Entry in UDecaySubsystem's store that actually counts this slot down (server only). */
+	UPROPERTY(NotReplicated)
+	int32 StoreId = INDEX_NONE;
+
 	FDecaySlot() {}
 	FDecaySlot(int32 InSlot, float InRemain, float InTotal, int32 InBatch)
 		: SlotIndex(InSlot), DecayTimeRemaining(InRemain), TotalDecayTime(InTotal), BatchSize(InBatch) {}
@@ -62,13 +90,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category="1_Inventory-Decay|Control")
 	bool bDecayActive = true;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category="1_Inventory-Decay|Control")
-	float DecayCheckInterval = 1.0f;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="1_Inventory-Decay|Control")
 	bool bAutoStopWhenIdle = true;
 
 	// --- Tuning ---
+	/** Written directly, takes effect at the next slot change; use SetDecaySpeedMultiplier to rebase at once. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category="1_Inventory-Decay|Tuning")
 	float DecaySpeedMultiplier = 1.0f;   // higher = faster
 
@@ -78,7 +104,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category="1_Inventory-Decay|Tuning")
 	int32 InputBatchSize = 1;            // items consumed per completion
 
+	/** Storage-type and environment tuning. Empty = built-in defaults. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="1_Inventory-Decay|Tuning")
+	TObjectPtr<UDecayProfileDataAsset> ProfileTable = nullptr;
+
 	// --- State (Rep) ---
+	/** Republished only when a slot's expiry or state changes; read live progress through GetSlotProgress. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_DecaySlots, Category="1_Inventory-Decay|State")
 	TArray<FDecaySlot> DecaySlots;
 
@@ -108,59 +139,90 @@ public:
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Decay|Control")
 	void ForceRefresh();
 
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Decay|Control")
+	void SetDecaySpeedMultiplier(float NewMultiplier);
+
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Decay|Control")
 	void RebindToInventory(UInventoryComponent* InInventory);
 
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Decay|Control")
 	void SetInventoryByActor(AActor* InActor);
 
+	/** Remaining item-seconds extrapolated from the replicated expiry, so it stays live between updates. */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Decay|Queries")
 	bool GetSlotProgress(int32 SlotIndex, float& OutRemaining, float& OutTotal) const;
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Decay|Queries")
 	bool IsIdle() const;
 
+	/** Re-evaluates tracking now; with bAutoStopWhenIdle an idle component stops tracking. */
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Decay|Control")
 	void StopIfIdle();
 
+	// --- Environment (Server) ---
+	/** Pushed by zones / heat sources when this inventory enters them. Re-pushing from the same Source replaces its tags. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Decay|Environment")
+	void PushEnvironment(UObject* Source, const FGameplayTagContainer& EnvironmentTags);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Decay|Environment")
+	void PopEnvironment(UObject* Source);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Decay|Environment")
+	FGameplayTagContainer GetActiveEnvironmentTags() const { return ActiveEnvironmentTags; }
+
+	/** Forwards a push/pop to every DecayComponent on Target (and on its PlayerState for pawns). */
+	static void NotifyEnvironmentEntered(AActor* Target, UObject* Source, const FGameplayTagContainer& EnvironmentTags);
+	static void NotifyEnvironmentExited(AActor* Target, UObject* Source);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 private:
-	FTimerHandle DecayTimerHandle;
+	friend class UDecaySubsystem;
 
-	bool bTickInProgress = false;
-	bool bRefreshRequested = false;
+	int32 StoreOwnerHandle = INDEX_NONE;
+
+	// Environment sources -> tags they currently apply; union cached in ActiveEnvironmentTags.
+	TMap<TWeakObjectPtr<UObject>, FGameplayTagContainer> ActiveEnvironments;
+	FGameplayTagContainer ActiveEnvironmentTags;
 
 	// Core
 	void ResolveInventory();
 	void BindInventoryChanged(bool bBind);
 	void ApplySettingsFromInventoryType();
 	int32 RefreshDecaySlots();
-	void TryStartStopFromCurrentState();
-	void StartTimer();
-	void StopTimer();
+	int32 FindTrackedSlot(int32 SlotIndex) const;
+	bool TrackSlot(int32 SlotIndex, const FInventoryItem& Item, float Now);
+	void UntrackAt(int32 TrackedIndex);
+	void ReconcileSlot(int32 SlotIndex, float Now);
+	void UpdateTrackingState();
 	bool HasAuthoritySafe() const;
 	bool IsInventoryValid() const { return Inventory != nullptr && GetOwner() && GetOwner()->HasAuthority(); }
 
-
-	// Tick
-	UFUNCTION()
-	void DecayTimerTick();
-
 	// Helpers
 	static UItemDataAsset* ResolveItemAsset(const FInventoryItem& SlotItem);
 	static UItemDataAsset* ResolveSoftItem(UItemDataAsset* MaybeLoaded, const TSoftObjectPtr<UItemDataAsset>& Soft);
 	float GetItemDecaySeconds(const UItemDataAsset* Asset) const;
 	int32 CalculateBatchOutput(int32 InputUsed) const;
 	bool ConsumeInputAtSlot_Server(int32 SlotIndex, int32 Quantity);
-	void CompactTrackedSlots();
 
-	// Inventory change hook
-	UFUNCTION()
-	void OnInventoryChangedRefresh();
+	// Store
+	UDecaySubsystem* GetDecaySubsystem() const;
+	void ReleaseStoreEntries();
+	void ApplyDecayCompletions(TArrayView<const FDecayCompletion> Completions);
+	void PublishFromStore();
+
+	// Rates
+	float ComputeEnvironmentMultiplier(const FGameplayTagContainer& ItemTags) const;
+	void RebaseSlot(FDecaySlot& S, float Now);
+	void RebaseSlots(bool bRecomputeEnvironment);
+	float GetServerTimeSeconds() const;
+	static void GatherItemTags(const UItemDataAsset* Asset, FGameplayTagContainer& Out);
+
+	// Inventory change hook: moves keep their timers, only changed slots are re-examined.
+	void HandleInventoryDelta(UInventoryComponent* Changed, const FInventoryDelta& Delta);
 
 	// RepNotifies
 	UFUNCTION()
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "DecayProfileDataAsset.generated.h"
+
+/** Decay tuning for one inventory type (e.g. Inventory.Type.ColdStorage). */
+USTRUCT(BlueprintType)
+struct RPGSYSTEM_API FDecayStorageProfile
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Decay")
+	FGameplayTag InventoryTypeTag;
+
+	/** Higher = faster. 0 stops decay entirely. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Decay", meta=(ClampMin="0.0"))
+	float DecaySpeedMultiplier = 1.0f;
+
+	/** Higher = more output per batch. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Decay", meta=(ClampMin="0.0"))
+	float EfficiencyRating = 1.0f;
+};
+
+/** Rate modifier applied while an inventory sits in an environment carrying EnvironmentTag (cold zone, campfire warmth...). */
+USTRUCT(BlueprintType)
+struct RPGSYSTEM_API FDecayEnvironmentProfile
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Decay")
+	FGameplayTag EnvironmentTag;
+
+	/** Multiplies the storage rate. <1 slows decay, >1 speeds it up. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Decay", meta=(ClampMin="0.0"))
+	float RateMultiplier = 1.0f;
+
+	/** Only items carrying any of these tags are affected. Empty = every decaying item. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Decay")
+	FGameplayTagContainer AffectedItemTags;
+};
+
+/**
+ * Data-driven decay tuning table.
+ * Lookups are cached by tag the first time they are needed; assign one to UDecayComponent::ProfileTable,
+ * or leave it empty to use the built-in defaults.
+ */
+UCLASS(BlueprintType)
+class RPGSYSTEM_API UDecayProfileDataAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Decay")
+	TArray<FDecayStorageProfile> StorageProfiles;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Decay")
+	TArray<FDecayEnvironmentProfile> EnvironmentProfiles;
+
+	const FDecayStorageProfile* FindStorageProfile(const FGameplayTag& InventoryTypeTag) const;
+	const FDecayEnvironmentProfile* FindEnvironmentProfile(const FGameplayTag& EnvironmentTag) const;
+
+	/** Table lookup with fallback to the built-in defaults when Table is null or has no row for the tag. */
+	static const FDecayStorageProfile* ResolveStorageProfile(const UDecayProfileDataAsset* Table, const FGameplayTag& InventoryTypeTag);
+	static const FDecayEnvironmentProfile* ResolveEnvironmentProfile(const UDecayProfileDataAsset* Table, const FGameplayTag& EnvironmentTag);
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void BuildCache() const;
+
+	mutable TMap<FGameplayTag, int32> StorageIndex;
+	mutable TMap<FGameplayTag, int32> EnvironmentIndex;
+	mutable bool bCacheBuilt = false;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** One kernel result: Count batches of the entry StoreId finished since it was last evaluated. */
+struct FDecayCompletion
+{
+	int32 StoreId   = INDEX_NONE;
+	int32 Owner     = INDEX_NONE;
+	int32 SlotIndex = INDEX_NONE;
+	int32 Count     = 0;
+};
+
+/**
+ * Struct-of-arrays backing store for every tracked decay stack in a world.
+ *
+ * Entries are addressed by stable ids; the parallel arrays stay dense (swap-remove) so the
+ * evaluation kernel walks contiguous memory and never touches an inventory.
+ * Times are server world seconds. Remaining/Total are item-seconds, consumed at Rate per second.
+ */
+struct RPGSYSTEM_API FDecaySlotStore
+{
+	/** ExpireTime of an entry that is not counting down (rate 0 or nothing left to decay). */
+	static constexpr double Stalled = TNumericLimits<double>::Max();
+
+	int32 Add(int32 Owner, int32 SlotIndex, float Total, float Remaining, float Rate, int32 AvailableBatches, double Now);
+	void Remove(int32 Id);
+	void Reset();
+
+	bool IsValidId(int32 Id) const { return IdToDense.IsValidIndex(Id) && IdToDense[Id] != INDEX_NONE; }
+	int32 Num() const { return ExpireTime.Num(); }
+
+	float  GetRemaining(int32 Id, double Now) const;
+	double GetExpireTime(int32 Id) const;
+
+	/** Re-bases the entry so its remaining item-seconds carry over to the new rate. Returns the new expiry. */
+	double SetRate(int32 Id, float NewRate, double Now);
+
+	/** The stack moved to another inventory slot; timing is untouched. */
+	void SetSlotIndex(int32 Id, int32 NewSlotIndex);
+
+	/** Batches the stack can still feed; 0 parks the entry. Returns the new expiry. */
+	double SetAvailableBatches(int32 Id, int32 NumBatches, double Now);
+
+	/**
+	 * Closed-form advance to Now. Every due entry completes min(Available, 1 + floor(Late / Period)) batches
+	 * in one step, so a long time skip costs the same as a single tick.
+	 * Appends one FDecayCompletion per finished entry and returns the earliest remaining expiry (Stalled if none).
+	 */
+	double Evaluate(double Now, TArray<FDecayCompletion>& OutCompleted);
+
+	/** Moves every running expiry Seconds earlier (admin time skip); call Evaluate afterwards. */
+	void Shift(double Seconds);
+
+private:
+	// Hot (kernel) data
+	TArray<double> ExpireTime;
+	TArray<float>  Rate;
+	TArray<float>  Total;
+	TArray<int32>  AvailableBatches;
+	TArray<int32>  Completions;
+
+	// Cold data
+	TArray<float>  Remaining;   // authoritative only while Stalled
+	TArray<int32>  SlotIndex;
+	TArray<int32>  Owner;
+
+	// Stable id <-> dense index
+	TArray<int32>  DenseToId;
+	TArray<int32>  IdToDense;
+	TArray<int32>  FreeIds;
+
+	float GetRemainingDense(int32 Dense, double Now) const;
+	void  Restart(int32 Dense, double Now);
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DecaySystem/DecaySlotStore.h"
+#include "DecaySubsystem.generated.h"
+
+class UDecayComponent;
+
+/**
+ * Server-side owner of every tracked decay stack in the world.
+ * DecayComponents register their slots here; one timer, scheduled for the earliest expiry,
+ * runs the SoA kernel and hands finished batches back to the owning components.
+ */
+UCLASS()
+class RPGSYSTEM_API UDecaySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// --- Owners ---
+	int32 RegisterOwner(UDecayComponent* Component);
+	void UnregisterOwner(int32 OwnerHandle);
+
+	// --- Entries ---
+	int32 AddEntry(int32 OwnerHandle, int32 SlotIndex, float Total, float Remaining, float Rate, int32 AvailableBatches);
+	void RemoveEntry(int32 StoreId);
+	void SetRate(int32 StoreId, float Rate);
+	void SetAvailableBatches(int32 StoreId, int32 NumBatches);
+	void SetSlotIndex(int32 StoreId, int32 SlotIndex) { Store.SetSlotIndex(StoreId, SlotIndex); }
+
+	float GetRemaining(int32 StoreId) const;
+
+	/** Server expiry of the current batch, -1 while stalled. */
+	float GetExpireTime(int32 StoreId) const;
+
+	/** Admin time skip: advances every tracked stack by Seconds and applies the results. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Decay|Admin")
+	void FastForward(float Seconds);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Decay|Admin")
+	int32 GetNumTrackedStacks() const { return Store.Num(); }
+
+private:
+	FDecaySlotStore Store;
+
+	TArray<TWeakObjectPtr<UDecayComponent>> Owners;
+	TArray<int32> FreeOwners;
+
+	FTimerHandle ProcessTimerHandle;
+	double ScheduledExpiry = FDecaySlotStore::Stalled;
+	bool bProcessing = false;
+
+	// Earliest expiry noted while ProcessDue applies completions; folded into Evaluate's result.
+	double ProcessingMinExpiry = FDecaySlotStore::Stalled;
+
+	double GetNow() const;
+	void NoteExpiry(double Expiry);
+	void ScheduleNext(double NextExpiry);
+	void ProcessDue();
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
+#include "Inventory/ItemResidencySubsystem.h"
 #include "EquipmentComponent.generated.h"
 
 class UItemDataAsset;
@@ -64,6 +65,8 @@ class RPGSYSTEM_API UEquipmentComponent : public UActorComponent
 public:
 	UEquipmentComponent();
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// --- Slot sets you author per character/class (BP-editable, not replicated) ---
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="1_Equipment-Slots|Weapons")
 	TArray<FEquipmentSlotDef> WeaponSlotDefs;
@@ -137,9 +140,15 @@ private:
 	bool ValidateItemForSlot(const FGameplayTag& SlotTag, const UItemDataAsset* Data) const;
 
 	// Server logic
+	/** False when rejected outright; an item that isn't resident yet equips once it streams in. */
 	bool Equip_Internal(const FGameplayTag& SlotTag, UInventoryComponent* SourceInventory, int32 SourceIndex);
+	bool FinishEquip(const FGameplayTag& SlotTag, UInventoryComponent* SourceInventory, int32 SourceIndex, UItemDataAsset* Data);
 	bool Unequip_Internal(const FGameplayTag& SlotTag, UInventoryComponent* DestInventory);
 
+	// Residency: equipped definitions stay cached while equipped
+	FItemResidencyPinSet ResidencyPins;
+	void RefreshResidencyPins();
+
 	// RPCs (implement *_Implementation in .cpp)
 	UFUNCTION(Server, Reliable)
 	void Server_TryEquipByInventoryIndex(FGameplayTag SlotTag, UInventoryComponent* SourceInventory, int32 SourceIndex);
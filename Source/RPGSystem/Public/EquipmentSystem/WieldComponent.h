@@ -32,6 +32,7 @@
 class UItemDataAsset;
 class UEquipmentComponent;
 class UDynamicToolbarComponent;
+struct FStreamableHandle;
 
 /** Pawn implements this to attach visuals & apply pose tags (BP-friendly). */
 UINTERFACE(BlueprintType)
@@ -208,6 +209,7 @@ protected:
 
 	UEquipmentComponent* ResolveEquipment() const;
 	UDynamicToolbarComponent* ResolveToolbar() const;
+	/** Resident data for ItemID; never blocks (a cold item starts streaming and returns null). */
 	UItemDataAsset* LoadByItemTag(const FGameplayTag& ItemID) const;
 
 	void GetActivePreferredSlots(TArray<FGameplayTag>& Out) const;
@@ -238,6 +240,15 @@ protected:
 	UFUNCTION() void HandleEquipmentCleared(FGameplayTag SlotTag);
 	UFUNCTION() void HandleToolbarActiveChanged(int32 NewIndex, UItemDataAsset* ItemData);
 
+	/** Data of WieldedItemIDTag, held so it stays resident while wielded. */
+	UPROPERTY(Transient)
+	TObjectPtr<UItemDataAsset> WieldedItemData = nullptr;
+
+	TSharedPtr<FStreamableHandle> WieldedItemLoad;
+
+	/** Streams in a wielded item that wasn't resident, then re-broadcasts item and pose. */
+	void ResolveWieldedItemAsync();
+
 	// GAS glue (engine) + optional GSC glue
 	UAbilitySystemComponent* ResolveASC_Engine() const;
 #if RPG_HAS_GSC
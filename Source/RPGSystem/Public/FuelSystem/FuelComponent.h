@@ -7,12 +7,90 @@
 
 class UInventoryComponent;
 class UItemDataAsset;
+class UCraftingStationComponent;
+struct FInventoryItem;
+struct FInventoryDelta;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FFuelProgressEvent, float, RemainingSeconds);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FFuelDepletedEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBurnStarted);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBurnStopped);
 
+/** Native: the fire started or stopped producing heat (burning and not paused). */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnFuelActiveChanged, bool /*bActive*/);
+
+/** Which fuel stack burns next. */
+UENUM(BlueprintType)
+enum class EFuelSelectionPolicy : uint8
+{
+	SlotOrder     UMETA(DisplayName="Slot Order"),
+	LongestBurn   UMETA(DisplayName="Longest Burn First"),
+	ShortestBurn  UMETA(DisplayName="Shortest Burn First")
+};
+
+/** Byproduct with its item data already resolved. */
+USTRUCT()
+struct FFuelByproductHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TObjectPtr<UItemDataAsset> Item = nullptr;
+	UPROPERTY() int32 Amount = 0;
+};
+
+/** Per fuel item: burn seconds and byproducts, resolved once. */
+USTRUCT()
+struct FFuelDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY() float BurnSeconds = 0.f;
+	UPROPERTY() TArray<FFuelByproductHandle> Byproducts;
+};
+
+/** One fuel-bearing slot in the cached queue. */
+USTRUCT()
+struct FFuelQueueEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 SlotIndex = INDEX_NONE;
+	UPROPERTY() TObjectPtr<UItemDataAsset> Item = nullptr;
+	UPROPERTY() int32 Quantity = 0;
+	UPROPERTY() float BurnSeconds = 0.f;
+};
+
+/**
+ * The fuel unit currently burning, as a closed-form window in server time.
+ * Remaining burn at time T is (EndServerTime - T); clients extrapolate from the replicated copy.
+ */
+USTRUCT(BlueprintType)
+struct FFuelBurnWindow
+{
+	GENERATED_BODY()
+
+	/** When the unit would have started at the current speed (back-projected after pause/speed changes). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float StartServerTime = -1.f;
+
+	/** Exact completion time; -1 while paused or not burning. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float EndServerTime = -1.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float SpeedMultiplier = 1.f;
+
+	/** Unscaled burn seconds of the unit (item data). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float FuelSeconds = 0.f;
+
+	/** Unscaled burn seconds left; authoritative only while paused. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float RemainingFuelSeconds = 0.f;
+
+	bool IsRunning() const { return EndServerTime >= 0.f; }
+};
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent), Blueprintable)
 class RPGSYSTEM_API UFuelComponent : public UActorComponent
 {
@@ -27,25 +105,34 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="1_Inventory-Fuel|Inventories")
 	UInventoryComponent* ByproductInventory = nullptr;
 
+	/** Wall seconds the current unit takes at the current speed. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Fuel|State")
 	float TotalBurnTime = 0.0f;
 
+	/** Snapshot taken at the last state change; use GetRemainingBurnSeconds() for a live value. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Fuel|State")
 	float RemainingBurnTime = 0.0f;
 
+	/** Higher = faster. Applied once, to the burn window; change at runtime via SetBurnSpeedMultiplier. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="1_Inventory-Fuel|Tuning")
 	float BurnSpeedMultiplier = 1.0f;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_BurnWindow, Category="1_Inventory-Fuel|State")
+	FFuelBurnWindow BurnWindow;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Fuel|State")
 	float LastBurnTime = 0.0f;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="1_Inventory-Fuel|Behavior")
 	bool bAutoStopBurnWhenIdle = true;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="1_Inventory-Fuel|State")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_IsBurning, Category="1_Inventory-Fuel|State")
 	bool bIsBurning = false;
 
-	/** Resolve byproduct items via tag -> data asset at burn time. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="1_Inventory-Fuel|Behavior")
+	EFuelSelectionPolicy SelectionPolicy = EFuelSelectionPolicy::SlotOrder;
+
+	/** Resolve byproduct items via tag -> data asset (once per fuel type, cached). */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="1_Inventory-Fuel|Tags")
 	bool bResolveByproductByTag = true;
 
@@ -61,6 +148,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="1_Inventory-Fuel|Events")
 	FOnBurnStopped OnBurnStopped;
 
+	/** Fired on edges of IsBurnActive(); fuel-gated stations pause/resume their job clock on it. */
+	FOnFuelActiveChanged OnFuelActiveChanged;
+
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Actions")
 	virtual void StartBurn();
 
@@ -79,29 +169,79 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Fuel|Queries")
 	bool IsBurning() const { return bIsBurning; }
 
+	/** Burning and not paused, i.e. the current unit is actually being consumed. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Fuel|Queries")
+	bool IsBurnActive() const { return bIsBurning && BurnWindow.IsRunning(); }
+
+	/** Seconds until the current unit finishes, extrapolated from BurnWindow (valid on clients). */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Fuel|Queries")
+	float GetRemainingBurnSeconds() const;
+
+	/** Wall seconds of burn the fire holds: the rest of the current unit plus every queued unit (server). */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Fuel|Queries")
+	float GetAvailableBurnSeconds() const;
+
+	/** 0..1 progress through the current unit. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Fuel|Queries")
+	float GetBurnProgress() const;
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Tuning")
+	void SetBurnSpeedMultiplier(float NewMultiplier);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Inventories")
+	void SetFuelInventory(UInventoryComponent* NewFuelInventory);
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Behavior")
+	void SetSelectionPolicy(EFuelSelectionPolicy NewPolicy);
+
+	/**
+	 * Offline catch-up: burns ElapsedSeconds worth of fuel in one pass (one removal per stack,
+	 * one add per byproduct type) and leaves the partial unit running. Returns units consumed.
+	 */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Actions")
+	int32 CatchUpBurn(float ElapsedSeconds);
+
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Actions")
 	void TryStartNextFuel();
 
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Behavior")
 	virtual bool ShouldKeepBurning() const;
 
+	/** A job started on the linked station: light the fire, or resume a banked unit. */
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Hooks")
 	virtual void OnCraftingActivated();
 
+	/** The linked station went idle: bank the current unit (with bAutoStopBurnWhenIdle) so no fuel is wasted. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Hooks")
+	virtual void OnCraftingDeactivated();
+
+	/** Called by UCraftingStationComponent::SetFuelSource; the station drives the hooks above. */
+	void SetLinkedStation(UCraftingStationComponent* Station);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/** One-shot, set for BurnWindow.EndServerTime. */
 	FTimerHandle BurnFuelTimer;
 
 	UFUNCTION()
-	virtual void BurnTimerTick();
+	virtual void BurnUnitComplete();
+
+	UFUNCTION()
+	void OnRep_BurnWindow();
+
+	UFUNCTION()
+	void OnRep_IsBurning();
 
 	void BurnFuelOnce();
+	void BurnUnits(int32 SlotIndex, int32 Units, TMap<UItemDataAsset*, int32>& InOutByproducts);
+	void GrantByproducts(const TMap<UItemDataAsset*, int32>& Byproducts);
 	void NotifyFuelStateChanged();
 
-	// Allow stations to decide if they are "active"
-	virtual bool IsCraftingActive() const { return true; }
+	// Allow stations to decide if they are "active"; an unlinked fire (campfire) always is.
+	virtual bool IsCraftingActive() const;
 
 private:
 	bool HasAuth() const
@@ -111,4 +251,31 @@ private:
 	}
 
 	void DoAutoStop();
+
+	// Cached fuel view, maintained from FuelInventory deltas
+	UPROPERTY(Transient)
+	TArray<FFuelQueueEntry> FuelQueue;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UItemDataAsset>, FFuelDefinition> FuelDefinitions;
+
+	/** Slot the current unit was taken from. */
+	int32 BurningSlot = INDEX_NONE;
+
+	TWeakObjectPtr<UCraftingStationComponent> LinkedStation;
+
+	/** Last value sent through OnFuelActiveChanged. */
+	bool bLastBurnActive = false;
+
+	void BindFuelInventory(bool bBind);
+	void HandleFuelInventoryDelta(UInventoryComponent* Changed, const FInventoryDelta& Delta);
+	void RebuildFuelQueue();
+	void RefreshQueueSlot(int32 SlotIndex);
+	void SortFuelQueue();
+	const FFuelDefinition* ResolveFuelDefinition(UItemDataAsset* Asset);
+
+	void BeginBurnWindow(float FuelSeconds);
+	void ScheduleBurnWindow(float Now);
+	void ClearBurnWindow();
+	float GetServerTimeSeconds() const;
 };
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "HeatFieldSubsystem.generated.h"
+
+class APawn;
+
+/** One registered heat source. Warmth at distance D is Intensity * (1 - D / Radius). */
+struct FHeatSource
+{
+	TWeakObjectPtr<AActor> Actor;
+	FVector Location = FVector::ZeroVector;
+	float Radius     = 0.f;
+	float Intensity  = 1.f;
+	FGameplayTagContainer EnvironmentTags;
+	bool bActive = false;
+	bool bInUse  = false;
+};
+
+/**
+ * Spatial index of every heat source in the world (campfires, burning fuel workstations).
+ * Sources live in a uniform XY grid, so point queries only test the fires sharing a cell.
+ * On the server, player pawns are refreshed in one batch while any source burns and receive
+ * the sources' environment tags through UDecayComponent, replacing per-fire pawn overlaps.
+ */
+UCLASS()
+class RPGSYSTEM_API UHeatFieldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// --- Sources ---
+	int32 RegisterSource(AActor* Source, float Radius, float Intensity, const FGameplayTagContainer& EnvironmentTags, bool bActive);
+	void UnregisterSource(int32 Handle);
+	void SetSourceActive(int32 Handle, bool bActive);
+
+	/** Re-reads the source actor's location and applies a new radius. */
+	void UpdateSource(int32 Handle, float Radius);
+
+	// --- Queries ---
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Fuel|Heat")
+	float GetWarmthAtPoint(const FVector& Point) const;
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Heat")
+	void GetSourcesAffectingPoint(const FVector& Point, TArray<AActor*>& OutSources) const;
+
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Heat")
+	void GetSourcesAffectingActor(const AActor* Target, TArray<AActor*>& OutSources) const;
+
+	/** Bulk form of GetWarmthAtPoint; OutWarmth must be as long as Points. */
+	void GetWarmthAtPoints(TConstArrayView<FVector> Points, TArrayView<float> OutWarmth) const;
+
+	/** Warmth for every player pawn in one batched pass. */
+	UFUNCTION(BlueprintCallable, Category="1_Inventory-Fuel|Heat")
+	void GetPlayerPawnWarmth(TArray<APawn*>& OutPawns, TArray<float>& OutWarmth) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory-Fuel|Heat")
+	int32 GetNumActiveSources() const { return NumActive; }
+
+private:
+	TArray<FHeatSource> Sources;
+	TArray<int32> FreeSources;
+	int32 NumActive = 0;
+
+	/** Cell -> source handles whose radius touches the cell. */
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	/** Active sources each player pawn currently receives environment tags from (sorted). */
+	TMap<TWeakObjectPtr<APawn>, TArray<int32>> PawnSources;
+
+	FTimerHandle PawnRefreshTimer;
+
+	static FIntPoint CellOf(const FVector& Point);
+	void LinkCells(int32 Handle, bool bLink);
+
+	/** Calls Visitor(Handle, Source, Falloff) for every active source reaching Point. */
+	template<typename FVisitor>
+	void ForEachSourceAt(const FVector& Point, FVisitor&& Visitor) const;
+
+	void UpdatePawnRefreshTimer();
+	void RefreshPlayerPawns();
+	void ExitSourceForAllPawns(int32 Handle);
+	bool PushesEnvironment() const;
+};
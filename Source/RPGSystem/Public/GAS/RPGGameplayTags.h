@@ -0,0 +1,35 @@
+// GAS/RPGGameplayTags.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+#include "Progression/ProgressionTags.h"
+
+// Every tag the module's C++ looks up at runtime. Native tags resolve once at startup, so call
+// sites compare against these instead of going through RequestGameplayTag(FName) each time.
+
+// Inventory access
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Access_Public);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Access_ViewOnly);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Access_Private);
+
+// Inventory (storage) types with built-in decay profiles
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Type_PlayerBag);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Type_Storage);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Type_CoolStorage);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Type_ColdStorage);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Type_StoreHouse);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Inventory_Type_Compost);
+
+// Zones
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Zone_Climate_Cold);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Zone_Climate_Warm);
+
+namespace RPGGameplayTags
+{
+	/** All native tags of the module, ProgressionTags included. */
+	RPGSYSTEM_API TConstArrayView<const FNativeGameplayTag*> GetAll();
+
+	/** Logs every native tag missing from DefaultGameplayTags.ini; returns how many are. */
+	RPGSYSTEM_API int32 ReportMissingFromConfig();
+}
@@ -4,11 +4,13 @@
 #include "CoreMinimal.h"
 #include "Engine/AssetManager.h"
 #include "GameplayTagContainer.h"
+#include "Inventory/ItemDataAsset.h"
 #include "InventoryAssetManager.generated.h"
 
-class UItemDataAsset;
 class UDataAsset;
 
+DECLARE_DELEGATE_OneParam(FDataAssetResolvedDelegate, UDataAsset* /*Data*/);
+
 /**
  * Generic tag->asset lookup for ANY DataAsset class.
  * Uses Asset Registry searchable tags when possible (no load),
@@ -38,6 +40,56 @@ public:
 	// Direct C++ helper (already-loaded)
 	UItemDataAsset* FindItemDataByTag(const FGameplayTag& ItemIdTag) const;
 
+	/** Reverse lookup through the tag index; never loads. */
+	bool ResolveItemTagByPath(const FSoftObjectPath& Path, FGameplayTag& OutTag) const;
+
+	// ===========================
+	// Non-blocking item resolution
+	// ===========================
+	// Resident items complete inside the call and return a null handle; anything else streams in
+	// and completes on the game thread on a later frame. The handle keeps the asset loaded while
+	// held and can cancel the request (CancelHandle); dropping it does not cancel the callback.
+
+	/** True when the item is loaded; never loads. */
+	bool IsItemResident(const FGameplayTag& ItemID) const { return FindItemDataByTag(ItemID) != nullptr; }
+
+	static TSharedPtr<FStreamableHandle> RequestItemData(const TSoftObjectPtr<UItemDataAsset>& Item, FItemDataResolvedDelegate OnResolved,
+		TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority);
+
+	TSharedPtr<FStreamableHandle> RequestItemDataByTag(const FGameplayTag& ItemID, FItemDataResolvedDelegate OnResolved,
+		TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority);
+
+	/** One streaming request for every non-resident item; OnResolved fires once with all of them. */
+	static TSharedPtr<FStreamableHandle> RequestItemDataBatch(const TArray<TSoftObjectPtr<UItemDataAsset>>& Items, FItemDataBatchResolvedDelegate OnResolved,
+		TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority);
+
+	TSharedPtr<FStreamableHandle> RequestItemDataBatchByTag(const TArray<FGameplayTag>& ItemIDs, FItemDataBatchResolvedDelegate OnResolved,
+		TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority);
+
+	// ===========================
+	// Item asset bundles
+	// ===========================
+	// Definitions registered as "ItemData" primary assets load with their Gameplay bundle. UI and
+	// World are added on demand and never on dedicated servers. Every request owns its handle; nothing
+	// goes through the asset manager's bundle state, which would keep the assets loaded for everyone.
+
+	/** Streams the item plus Bundles (e.g. UItemDataAsset::BundleWorld) on top of what it already has.
+	 *  Items that aren't registered primary assets complete like RequestItemData. */
+	static TSharedPtr<FStreamableHandle> RequestItemBundles(const TSoftObjectPtr<UItemDataAsset>& Item, const TArray<FName>& Bundles, FItemDataResolvedDelegate OnResolved,
+		TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority);
+
+	/** Gameplay plus the requested bundles; Gameplay only on a dedicated server. */
+	static TArray<FName> GetItemBundlesToLoad(TConstArrayView<FName> Requested = {});
+
+	/** Per bundle: referenced assets, how many are resident and their estimated size (console: Inventory.BundleMemory). */
+	void LogItemBundleMemory() const;
+
+private:
+	/** One streamable request for Paths plus, for registered items, the assets of Bundles. */
+	static TSharedPtr<FStreamableHandle> StreamItemsWithBundles(TConstArrayView<FSoftObjectPath> Paths, TConstArrayView<FName> Bundles,
+		FStreamableDelegate OnLoaded, TAsyncLoadPriority Priority);
+
+public:
 	// =======================================================
 	// NEW: Generic tagged loading for ANY UDataAsset class
 	// =======================================================
@@ -54,7 +106,10 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory|Assets")
 	bool ResolveDataAssetPathByTag(const FGameplayTag& Tag, TSubclassOf<UDataAsset> AssetClass, FSoftObjectPath& OutPath) const;
 
-	/** Loads (sync) or requests (async) the asset. For async, returns nullptr immediately; prefer sync for server logic. */
+	/** The ID tag the index holds for Path; never loads. */
+	bool ResolveDataAssetTagByPath(const FSoftObjectPath& Path, TSubclassOf<UDataAsset> AssetClass, FGameplayTag& OutTag) const;
+
+	/** Loads (sync) or requests (async) the asset. For async, returns the asset only if already resident; use RequestDataAssetByTag for a callback. */
 	UFUNCTION(BlueprintCallable, Category="1_Inventory|Assets")
 	UDataAsset* LoadDataAssetByTag(const FGameplayTag& Tag, TSubclassOf<UDataAsset> AssetClass, bool bSyncLoad = true);
 
@@ -65,22 +120,46 @@ public:
 		return Cast<TAsset>(LoadDataAssetByTag(Tag, TAsset::StaticClass(), bSyncLoad));
 	}
 
+	/** Non-blocking form of LoadDataAssetByTag; same resident fast path and handle rules as RequestItemData. */
+	TSharedPtr<FStreamableHandle> RequestDataAssetByTag(const FGameplayTag& Tag, TSubclassOf<UDataAsset> AssetClass, FDataAssetResolvedDelegate OnResolved,
+		TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority);
+
+	// =======================================================
+	// Cooked tag index table
+	// =======================================================
+	// Cooked builds read the tag->path maps from a table written at cook time (or by
+	// -run=InventoryTagIndex) instead of scanning the registry and soft-loading assets
+	// whose tag isn't searchable. The table carries a stamp of the registered classes and the
+	// packages holding their assets, taken from the cook's package set. At boot only the package
+	// names are hashed to check it (no tag reads); if the live registry disagrees (patch, DLC,
+	// mods) the table is discarded and every registered class is scanned.
+
+	/** Content/RPGSystem/InventoryTagIndex.bin; staged as UFS through DefaultGame.ini. */
+	static FString GetTagIndexTablePath();
+
+	/** Rescans every registered class and writes the table to FilePath; limited to CookedPackages when given. */
+	bool WriteTagIndexTable(const FString& FilePath, const TSet<FName>* CookedPackages = nullptr);
+
+#if WITH_EDITOR
+	/** Regenerates the table from the cooked package set of every cook, so a packaged build never ships a stale one. */
+	virtual void PreSaveAssetRegistry(const ITargetPlatform* TargetPlatform, const TSet<FName>& InCookedPackages) override;
+#endif
+
 protected:
-	// Build the legacy item index (kept) and the generic class maps.
-	void BuildItemIndex();
+	// Indexes every registered class (items included), replacing whatever each class's index held.
 	void BuildGenericTagIndices();
 
-	// Internal: try to index a class using AssetRegistry tags; fallback to soft load to read property if needed.
-	void IndexTaggedClass(UClass* InClass, FName TagPropName, FName AssetRegistryKeyName);
-
 	// Internal: reflection reader for FGameplayTag property on a loaded object.
 	static bool TryReadGameplayTagProperty(UObject* Obj, FName TagPropName, FGameplayTag& OutTag);
 
-private:
-	// --------- Legacy (items) ----------
-	UPROPERTY() // OK: simple map, no nested maps/weak keys
-	TMap<FGameplayTag, FSoftObjectPath> ItemTagToPath;
+	// Cooked table: fills ClassTagIndices only when it matches the live registry (no scan needed).
+	bool LoadTagIndexTable(const FString& FilePath);
+
+	// Order-independent hash of the registered classes and the package names of their assets in
+	// the live registry; only packages in OnlyPackages when given (the cook's output).
+	uint64 ComputeTagIndexPackageStamp(const TSet<FName>* OnlyPackages = nullptr) const;
 
+private:
 	// --------- Generic maps (runtime only; not reflected) ------------
 	struct FTaggedClassCfg
 	{
@@ -92,6 +171,47 @@ private:
 	// No UPROPERTY: avoids UHT constraints (weak keys, nested maps).
 	TArray<FTaggedClassCfg> TaggedClassConfigs;
 
-	// Per-class tag->path map
-	TMap<UClass*, TMap<FGameplayTag, FSoftObjectPath>> ClassToTagMap;
+	// Per-class maps; items live here too (UItemDataAsset), there is no separate item map.
+	struct FClassTagIndex
+	{
+		TMap<FGameplayTag, FSoftObjectPath> ByTag;
+		TMap<FSoftObjectPath, FGameplayTag> ByPath; // reverse, for removals and renames
+	};
+	TMap<UClass*, FClassTagIndex> ClassTagIndices;
+
+	// Registry value (already stripped to the tag name) -> tag; valid tags only.
+	TMap<FName, FGameplayTag> ParsedTagCache;
+
+	// Asset class path -> indices into TaggedClassConfigs it belongs to (itself or a parent registered).
+	TMap<FTopLevelAssetPath, TArray<int32>> ConfigsByAssetClass;
+
+	// Assets reported by the registry without a searchable tag; soft-loaded off the event, on the next tick.
+	struct FPendingSlowPath
+	{
+		int32 Cfg = INDEX_NONE;
+		FSoftObjectPath Path;
+	};
+	TArray<FPendingSlowPath> PendingSlowPath;
+	bool bSlowPathFlushQueued = false;
+
+	// Set once StartInitialLoading built the index; registry events and late registrations update it from then on.
+	bool bTagIndicesBuilt = false;
+
+	void IndexTaggedClasses(TConstArrayView<int32> CfgIndices);
+	void IndexAsset(int32 CfgIdx, const FAssetData& AD);
+	void FlushPendingSlowPath();
+
+	FGameplayTag ResolveTagName(FName TagName);
+	const TArray<int32>& GetConfigsForAssetClass(const FTopLevelAssetPath& ClassPath);
+
+	static void AddIndexEntry(FClassTagIndex& Index, const FGameplayTag& Tag, const FSoftObjectPath& Path);
+	static void RemoveIndexEntry(FClassTagIndex& Index, const FSoftObjectPath& Path);
+
+	// Incremental updates (editor saves, mounted DLC/mod content) instead of rebuilding.
+	void BindRegistryEvents();
+	void HandleAssetAdded(const FAssetData& AD);
+	void HandleAssetRemoved(const FAssetData& AD);
+	void HandleAssetRenamed(const FAssetData& AD, const FString& OldObjectPath);
+	void HandleAssetUpdated(const FAssetData& AD);
+	void HandleFilesLoaded();
 };
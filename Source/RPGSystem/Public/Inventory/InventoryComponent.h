@@ -7,9 +7,50 @@
 #include "GameplayTagContainer.h"
 #include "InventoryItem.h"
 #include "ItemDataAsset.h"
+#include "Inventory/ItemResidencySubsystem.h"
 #include "InventoryComponent.generated.h"
 
 class AController;
+class UInventoryComponent;
+
+/** Slot-level summary of one change batch; lets listeners update incrementally instead of rescanning. */
+struct RPGSYSTEM_API FInventoryDelta
+{
+	/** Item that was at From is now at To, unchanged (sort, swap). Applied before ChangedSlots. */
+	TArray<TPair<int32, int32>> Moves;
+
+	/** Slots whose content (item or quantity) changed. */
+	TArray<int32> ChangedSlots;
+
+	/** Layout changed without slot detail (resize, bulk edit); listeners should rescan. */
+	bool bFullRefresh = false;
+
+	bool IsEmpty() const { return Moves.Num() == 0 && ChangedSlots.Num() == 0 && !bFullRefresh; }
+	void Reset() { Moves.Reset(); ChangedSlots.Reset(); bFullRefresh = false; }
+};
+
+/** One line of a reservation: Quantity of ItemIDTag held for a pending withdrawal. */
+struct RPGSYSTEM_API FInventoryReservationLine
+{
+	FGameplayTag ItemIDTag;
+	int32 Quantity = 0;
+};
+
+/** Quantity of one item held by open reservations; replicated so clients know what is actually available. */
+USTRUCT()
+struct RPGSYSTEM_API FInventoryReservedQuantity
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FGameplayTag ItemIDTag;
+	UPROPERTY() int32 Quantity = 0;
+};
+
+/** Native: reserved quantities of these items changed (server on reserve/release, clients on replication). */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInventoryReservationsChanged, UInventoryComponent* /*Inventory*/, TConstArrayView<FGameplayTag> /*ItemIDTags*/);
+
+/** Native (C++ only) companion of OnInventoryChanged, fired right before it; on clients too, diffed from replication. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInventoryDelta, UInventoryComponent* /*Inventory*/, const FInventoryDelta& /*Delta*/);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInventorySlotUpdated, int32, SlotIndex);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInventoryChanged);
@@ -49,6 +90,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category="1_Inventory|Actions") virtual bool MoveItem(int32 FromIndex, int32 ToIndex, AActor* Requestor = nullptr);
 	UFUNCTION(BlueprintCallable, Category="1_Inventory|Actions") virtual bool TransferItemToInventory(int32 FromIndex, UInventoryComponent* TargetInventory, AActor* Requestor = nullptr);
 
+	/** Server only: adds every stack or none, as one change batch (one weight pass, one notification). */
+	bool AddItems(const TArray<TPair<UItemDataAsset*, int32>>& Stacks, AActor* Requestor = nullptr);
+
 	// Client helpers (auto-RPC)
 	UFUNCTION(BlueprintCallable, Category="1_Inventory|Actions") virtual bool TryAddItem(UItemDataAsset* ItemData, int32 Quantity);
 	UFUNCTION(BlueprintCallable, Category="1_Inventory|Actions") virtual bool TryRemoveItem(int32 SlotIndex, int32 Quantity);
@@ -101,6 +145,16 @@ public:
 	const TArray<FInventoryItem>& GetItems() const { return Items; }
 	const TArray<FInventoryItem>& GetItem() const { return Items; }
 
+	// Reservations (server only). Two-phase withdrawals: reserved quantity stays in its slots but no
+	// other remover can take it until the reservation is committed (removed in one batch) or released.
+	// The per-item totals replicate, so the quantity queries below answer on clients too.
+	int32 ReserveItems(const TArray<FInventoryReservationLine>& Lines);
+	bool CommitReservation(int32 ReservationId, UInventoryComponent* Target = nullptr);
+	void ReleaseReservation(int32 ReservationId);
+	bool HasReservation(int32 ReservationId) const { return Reservations.Contains(ReservationId); }
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory|Queries") int32 GetReservedQuantity(FGameplayTag ItemID) const { return ReservedByTag.FindRef(ItemID); }
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory|Queries") int32 GetAvailableQuantity(FGameplayTag ItemID) const;
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory|Queries") bool IsEmpty() const { return GetNumOccupiedSlots() == 0; }
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="1_Inventory|Queries") bool IsNotEmpty() const { return GetNumOccupiedSlots() > 0; }
 
@@ -142,6 +196,8 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="1_Inventory|Events") FOnItemAdded OnItemAdded;
 	UPROPERTY(BlueprintAssignable, Category="1_Inventory|Events") FOnItemRemoved OnItemRemoved;
 	UPROPERTY(BlueprintAssignable, Category="1_Inventory|Events") FOnItemTransferSuccess OnItemTransferSuccess;
+	FOnInventoryDelta OnInventoryDelta;
+	FOnInventoryReservationsChanged OnReservationsChanged;
 
 	UPROPERTY(Transient)
 	TArray<FInventoryItem> ClientPrevItems;	
@@ -152,21 +208,49 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(ReplicatedUsing=OnRep_InventoryItems, BlueprintReadOnly, Category="1_Inventory|Data")
 	TArray<FInventoryItem> Items;
 
 	UFUNCTION() void OnRep_InventoryItems();
 
+	UPROPERTY(ReplicatedUsing=OnRep_ReservedQuantities)
+	TArray<FInventoryReservedQuantity> ReservedQuantities;
+
+	UFUNCTION() void OnRep_ReservedQuantities();
+
 	void NotifySlotChanged(int32 SlotIndex);
+	void NotifySlotMoved(int32 FromIndex, int32 ToIndex);
 	void NotifyInventoryChanged();
 	void UpdateItemIndexes();
+	void RecordReorder();
 	void AdjustSlotCountIfNeeded();
 	AController* ResolveRequestorController(AActor* ExplicitRequestor) const;
 	void RecalculateWeightAndVolume();
 
 	bool bWasFull = false;
 
+	// Accumulated since the last NotifyInventoryChanged.
+	FInventoryDelta PendingDelta;
+
+	// Residency: definitions held in slots stay cached while they are held
+	FItemResidencyPinSet ResidencyPins;
+	void RefreshResidencyPins();
+
+	// Open reservations by id (server), and their sum per item tag (server, mirrored from ReservedQuantities on clients).
+	TMap<int32, TArray<FInventoryReservationLine>> Reservations;
+	TMap<FGameplayTag, int32> ReservedByTag;
+	int32 NextReservationId = 0;
+
+	/** Server: copies ReservedByTag into the replicated list and tells listeners which items changed. */
+	void PublishReservations(TConstArrayView<FGameplayTag> ChangedTags);
+
+	/** False if taking Quantity from the slot would dip into quantity reserved for someone else. */
+	bool CanWithdraw(const FInventoryItem& Slot, int32 Quantity) const;
+	bool CanReceive(const TArray<TPair<UItemDataAsset*, int32>>& Stacks) const;
+	void PlaceStacks(const TArray<TPair<UItemDataAsset*, int32>>& Stacks);
+
 public:
 	// RPCs
 	UFUNCTION(Server, Reliable, WithValidation) void ServerAddItem(UItemDataAsset* ItemData, int32 Quantity, AController* Requestor);
@@ -33,7 +33,8 @@ public:
 	static bool CreateWidgetOnInteractor(AActor* Interactor, TSubclassOf<UUserWidget> WidgetClass, UUserWidget*& OutWidget);
 
 	// -------- Tag → Asset helpers (BP-visible) --------
-	/** Resolve an ItemData asset by ItemIDTag (sync load by default). */
+	/** Resolve an ItemData asset by ItemIDTag (sync load by default; resident items never hit the loader).
+	 *  With bSyncLoad=false a cold item returns null and starts streaming; C++ callers wanting a callback use UInventoryAssetManager::RequestItemDataByTag. */
 	UFUNCTION(BlueprintCallable, Category="1_Inventory-Helpers|Assets")
 	static UItemDataAsset* FindItemDataByTag(UObject* WorldContextObject, FGameplayTag ItemIDTag, bool bSyncLoad /*= true*/);
 
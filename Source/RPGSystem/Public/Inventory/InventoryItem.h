@@ -6,6 +6,7 @@
 #include "InventoryItem.generated.h"
 
 class UItemDataAsset;
+struct FStreamableHandle;
 
 USTRUCT(BlueprintType)
 struct RPGSYSTEM_API FInventoryItem
@@ -25,16 +26,28 @@ public:
 	int32 Index = INDEX_NONE;
 
 	// --- C++ helpers (no UFUNCTION inside USTRUCT) ---
+	/** Occupied slot. By path, not by load state: a definition that isn't resident still owns its slot. */
 	FORCEINLINE bool IsValid() const
 	{
-		return ItemData.IsValid() && Quantity > 0;
+		return !ItemData.IsNull() && Quantity > 0;
 	}
 
-	FORCEINLINE UItemDataAsset* ResolveItemData() const
+	/** The definition's ItemIDTag: from the loaded asset, else from the asset manager's tag index. Never loads. */
+	FGameplayTag GetItemIDTag() const;
+
+	/** Loaded data or null; never loads. */
+	FORCEINLINE UItemDataAsset* GetResidentItemData() const
 	{
-		return ItemData.IsNull() ? nullptr : ItemData.LoadSynchronous();
+		return ItemData.Get();
 	}
 
+	/** Blocking: loads on the calling thread if needed. Prefer RequestItemData on the game thread.
+	 *  Either way the definition is held by the residency cache instead of by whoever references it. */
+	UItemDataAsset* ResolveItemData() const;
+
+	/** Non-blocking: completes inside the call when resident, otherwise once streamed in. */
+	TSharedPtr<FStreamableHandle> RequestItemData(FItemDataResolvedDelegate OnResolved) const;
+
 	FORCEINLINE bool CanStackWith(UItemDataAsset* Other) const
 	{
 		const UItemDataAsset* Self = ItemData.Get();
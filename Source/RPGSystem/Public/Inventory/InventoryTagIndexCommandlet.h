@@ -0,0 +1,22 @@
+// InventoryTagIndexCommandlet.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "InventoryTagIndexCommandlet.generated.h"
+
+/**
+ * Writes UInventoryAssetManager's cooked tag index table outside a cook, e.g. from CI:
+ *   UnrealEditor-Cmd <Project> -run=InventoryTagIndex [-Output=<file>]
+ * Cooks regenerate the table on their own (UInventoryAssetManager::PreSaveAssetRegistry).
+ */
+UCLASS()
+class RPGSYSTEM_API UInventoryTagIndexCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UInventoryTagIndexCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
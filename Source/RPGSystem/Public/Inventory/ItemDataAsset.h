@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "GameplayTagContainer.h"
+#include "Inventory/SyncLoadStats.h"
 #include "ItemDataAsset.generated.h"
 
 // Forward decls
@@ -12,6 +13,13 @@ class UTexture2D;
 class UAnimMontage;
 class UUserWidget;
 class UGameplayEffect;
+class UItemDataAsset;
+
+/** Completion of a non-blocking item resolution (see UInventoryAssetManager::RequestItemData); null when nothing resolved. */
+DECLARE_DELEGATE_OneParam(FItemDataResolvedDelegate, UItemDataAsset* /*Data*/);
+
+/** Completion of a batched resolution; entries line up with the request, null where nothing resolved. */
+DECLARE_DELEGATE_OneParam(FItemDataBatchResolvedDelegate, const TArray<UItemDataAsset*>& /*Data*/);
 
 /** Optional byproduct definition for fuels (kept from your version) */
 USTRUCT(BlueprintType)
@@ -74,7 +82,7 @@ struct FItemAction
 	FText DisplayName;
 
 	/** Optional montage to play for UX */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Action")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Action", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UAnimMontage> Montage;
 
 	/** If true, you intend to apply effects directly when this action triggers */
@@ -86,21 +94,36 @@ struct FItemAction
 	TArray<FGameplayTag> EffectTags;
 
 	/** Optional GAS effects (soft class). Only add GameplayAbilities module if you actually use these. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Action", meta=(EditCondition="bApplyEffectsDirectly"))
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Action", meta=(EditCondition="bApplyEffectsDirectly", AssetBundles="Gameplay"))
 	TArray<TSoftClassPtr<UGameplayEffect>> GameplayEffects;
 };
 
 /**
  * Base item data (parent of everything).
+ *
+ * A primary asset ("ItemData") whose soft references are grouped into asset bundles:
+ * UI (icon), World (meshes, FX, sounds, montages) and Gameplay (effects). UInventoryAssetManager
+ * loads a definition with Gameplay only; dedicated servers never load the other two, clients
+ * request them on demand (RequestItemBundles).
  */
 UCLASS(BlueprintType)
-class RPGSYSTEM_API UItemDataAsset : public UDataAsset
+class RPGSYSTEM_API UItemDataAsset : public UPrimaryDataAsset
 {
 	GENERATED_BODY()
 
 public:
+	// --- Asset bundles ---
+	static const FName BundleUI;
+	static const FName BundleWorld;
+	static const FName BundleGameplay;
+
+	static const FPrimaryAssetType ItemPrimaryAssetType;
+
+	/** Every item class shares one primary asset type, weapons included. */
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
 	// --- UI ---
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="UI")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="UI", meta=(AssetBundles="UI"))
 	TSoftObjectPtr<UTexture2D> Icon;
 
 	// Searchable in cooked
@@ -179,7 +202,7 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="World")
 	TSoftClassPtr<AActor> WorldActorClass;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="World")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="World", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UStaticMesh> WorldMesh;
 
 	// --- Tags (legacy) ---
@@ -281,11 +304,13 @@ public:
 	bool bCraftingEnabled = false;
 
 	// --- Cook-safe sync helpers (kept) ---
+	/** Null on dedicated servers: the World bundle is never streamed there and world items don't need the mesh. */
 	UFUNCTION(BlueprintCallable, Category="1_Inventory|ItemData")
-	UStaticMesh* GetWorldMeshSync() const { return WorldMesh.IsNull() ? nullptr : WorldMesh.LoadSynchronous(); }
+	UStaticMesh* GetWorldMeshSync() const { return IsRunningDedicatedServer() ? nullptr : InventorySyncLoad::Load(WorldMesh, TEXT("ItemData.GetWorldMeshSync")); }
 
+	/** Null on dedicated servers: nothing there draws an icon. */
 	UFUNCTION(BlueprintCallable, Category="1_Inventory|ItemData")
-	UTexture2D* GetIconSync() const { return Icon.IsNull() ? nullptr : Icon.LoadSynchronous(); }
+	UTexture2D* GetIconSync() const { return IsRunningDedicatedServer() ? nullptr : InventorySyncLoad::Load(Icon, TEXT("ItemData.GetIconSync")); }
 
 	// --- Queries (kept) ---
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Heirloom")
@@ -0,0 +1,149 @@
+// ItemResidencySubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "ItemResidencySubsystem.generated.h"
+
+USTRUCT(BlueprintType)
+struct RPGSYSTEM_API FItemResidencyStats
+{
+	GENERATED_BODY()
+
+	/** Lookups that found the asset cached. */
+	UPROPERTY(BlueprintReadOnly, Category="1_Inventory|Residency")
+	int64 Hits = 0;
+
+	/** Lookups that had to load, or found an asset only GC happened to keep alive. */
+	UPROPERTY(BlueprintReadOnly, Category="1_Inventory|Residency")
+	int64 Misses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="1_Inventory|Residency")
+	int64 Evictions = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="1_Inventory|Residency")
+	int32 NumResident = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="1_Inventory|Residency")
+	int32 NumPinned = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="1_Inventory|Residency")
+	float ResidentMB = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="1_Inventory|Residency")
+	float PinnedMB = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="1_Inventory|Residency")
+	float BudgetMB = 0.f;
+};
+
+/** One cached definition. */
+USTRUCT()
+struct FResidentAsset
+{
+	GENERATED_BODY()
+
+	/** Keeps the asset loaded while it is cached. Null while a pin waits for the load. */
+	UPROPERTY()
+	TObjectPtr<UObject> Object = nullptr;
+
+	/** Its asset bundle members that were resident when it was added; held and counted with it. */
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> BundleObjects;
+
+	FSoftObjectPath Path;
+	uint64 Bytes = 0;
+	int32 PinCount = 0;
+
+	// LRU links; only loaded, unpinned entries are linked.
+	int32 Prev = INDEX_NONE;
+	int32 Next = INDEX_NONE;
+	bool bLinked = false;
+
+	bool bInUse = false;
+};
+
+/**
+ * Keeps loaded item definitions and recipes resident on purpose instead of by accident of GC.
+ *
+ * Everything resolved through UInventoryAssetManager lands here. Assets in use (equipped, shown in
+ * an open inventory, an active craft) hold pins and are never evicted; the rest sit in an LRU that
+ * is trimmed to Inventory.ResidentBudgetMB. Eviction only drops the cache's own references: an asset
+ * someone else still holds a handle to stays loaded, and GC takes it once nobody does.
+ */
+UCLASS()
+class RPGSYSTEM_API UItemResidencySubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UItemResidencySubsystem* Get();
+
+	virtual void Deinitialize() override;
+
+	// --- Cache ---
+	/** Counts a hit (cached; moves it to the LRU head) or a miss, and returns the cached asset. */
+	UObject* Find(const FSoftObjectPath& Path);
+
+	/** Caches a loaded asset, or refreshes it, at the LRU head; then trims to the budget. */
+	void Add(UObject* Asset);
+
+	/** Evicts least recently used unpinned assets until the cache fits the budget. */
+	void Trim();
+
+	// --- Pins ---
+	/** Pinned assets are never evicted. Works before the asset loads; Add fills the entry in. */
+	int32 Pin(const FSoftObjectPath& Path);
+	void Unpin(int32 PinHandle);
+
+	// --- Stats ---
+	UFUNCTION(BlueprintCallable, Category="1_Inventory|Residency")
+	FItemResidencyStats GetStats() const;
+
+	void ResetStats();
+
+private:
+	UPROPERTY(Transient)
+	TArray<FResidentAsset> Entries;
+	TArray<int32> FreeEntries;
+	TMap<FSoftObjectPath, int32> EntryByPath;
+
+	/** Pin handle -> entry. */
+	TArray<int32> Pins;
+	TArray<int32> FreePins;
+
+	/** Most recently used first. */
+	int32 LruHead = INDEX_NONE;
+	int32 LruTail = INDEX_NONE;
+
+	/** Sum of Bytes over loaded entries, pinned or not. */
+	uint64 CachedBytes = 0;
+
+	int64 Hits = 0;
+	int64 Misses = 0;
+	int64 Evictions = 0;
+
+	int32 FindOrAddEntry(const FSoftObjectPath& Path);
+	void ReleaseEntry(int32 Idx);
+	void LinkFront(int32 Idx);
+	void Unlink(int32 Idx);
+	void Evict(int32 Idx);
+
+	/** Takes Asset and whatever of its asset bundles is resident into E; returns their estimated size. */
+	static uint64 Capture(FResidentAsset& E, UObject* Asset);
+};
+
+/**
+ * Pins for a set of assets that changes over time: a component's equipped items, the items an
+ * open inventory shows, the recipes of active crafts. Sync with the current set after each change.
+ */
+struct RPGSYSTEM_API FItemResidencyPinSet
+{
+	/** Pins what is new in Paths and unpins what is gone. Null paths are ignored. */
+	void Sync(TConstArrayView<FSoftObjectPath> Paths);
+
+	void Reset();
+
+private:
+	TMap<FSoftObjectPath, int32> Pinned;
+};
@@ -46,19 +46,19 @@ public:
 	FName CaseEjectSocketName = TEXT("Eject");
 
 	/** Optional Niagara muzzle FX (preferred if Niagara module present). */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|FX")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|FX", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UNiagaraSystem> MuzzleFXNiagara;
 
 	/** Optional Niagara case-eject FX. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|FX")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|FX", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UNiagaraSystem> CaseEjectFXNiagara;
 
 	/** Optional Cascade muzzle FX (fallback if you don't use Niagara). */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|FX")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|FX", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UParticleSystem> MuzzleFXCascade;
 
 	/** Optional Cascade case-eject FX. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|FX")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|FX", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UParticleSystem> CaseEjectFXCascade;
 
 	/** If true, eject (FX and/or a casing actor) when firing. */
@@ -136,18 +136,19 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|Audio", meta=(ClampMin="0.0"))
 	float Loudness = 1.0f;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|Audio")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|Audio", meta=(AssetBundles="World"))
 	TSoftObjectPtr<USoundBase> FireSound;
 
 	
+	/** Null on dedicated servers (no audio device). */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Ranged|Audio")
 	USoundBase* GetFireSoundSync() const;
 
 	// ------------ ANIM ------------
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|Anim")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|Anim", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UAnimMontage> ReloadMontage;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|Anim")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Ranged|Anim", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UAnimMontage> FireMontage;
 
 	// ------------ IK ------------
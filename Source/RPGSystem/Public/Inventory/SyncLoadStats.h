@@ -0,0 +1,67 @@
+// SyncLoadStats.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPtr.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * Instrumentation for the module's synchronous loads. Every blocking load goes through Load/TryLoad
+ * with a call-site name. The name becomes a named scope in Insights and a counter (calls, how many
+ * found the asset resident, time spent) in the Inventory.SyncLoads report and the InventorySyncLoads
+ * CSV category, and loads that miss are kept in a short history with the asset and duration.
+ */
+namespace InventorySyncLoad
+{
+	/**
+	 * Attributes the sync loads below it on this thread to Site, e.g. a caller of FindItemDataByTag
+	 * whose load physically happens inside the asset manager. The outermost call site wins.
+	 */
+	struct RPGSYSTEM_API FCallSite
+	{
+		explicit FCallSite(const TCHAR* Site);
+		~FCallSite();
+
+		UE_NONCOPYABLE(FCallSite);
+
+	private:
+		const TCHAR* Previous;
+	};
+
+	/** Site must be a string literal; it is used as the key. */
+	RPGSYSTEM_API void Record(const TCHAR* Site, const FSoftObjectPath& Path, double Seconds, bool bWasResident);
+
+	RPGSYSTEM_API void LogReport();
+	RPGSYSTEM_API void Reset();
+
+	template<typename TLoad>
+	auto Timed(const TCHAR* Site, const FSoftObjectPath& Path, TLoad&& DoLoad)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(Site);
+		const bool bWasResident = Path.ResolveObject() != nullptr;
+		const double Start = FPlatformTime::Seconds();
+		auto Result = DoLoad();
+		Record(Site, Path, FPlatformTime::Seconds() - Start, bWasResident);
+		return Result;
+	}
+
+	template<typename T>
+	T* Load(const TSoftObjectPtr<T>& Asset, const TCHAR* Site)
+	{
+		if (Asset.IsNull()) return nullptr;
+		return Timed(Site, Asset.ToSoftObjectPath(), [&Asset]() { return Asset.LoadSynchronous(); });
+	}
+
+	template<typename T>
+	UClass* Load(const TSoftClassPtr<T>& Class, const TCHAR* Site)
+	{
+		if (Class.IsNull()) return nullptr;
+		return Timed(Site, Class.ToSoftObjectPath(), [&Class]() { return Class.LoadSynchronous(); });
+	}
+
+	inline UObject* TryLoad(const FSoftObjectPath& Path, const TCHAR* Site)
+	{
+		if (Path.IsNull()) return nullptr;
+		return Timed(Site, Path, [&Path]() { return Path.TryLoad(); });
+	}
+}
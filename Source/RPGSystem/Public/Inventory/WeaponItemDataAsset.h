@@ -36,10 +36,10 @@ public:
 	FName HolsteredSocket = NAME_None;
 
 	// Holster/unholster animations
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Anim")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Anim", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UAnimMontage> HolsterMontage;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Anim")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Anim", meta=(AssetBundles="World"))
 	TSoftObjectPtr<UAnimMontage> UnholsterMontage;
 
 	// Skill + XP on successful hit/contact
@@ -56,7 +56,7 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Damage", meta=(EditCondition="bUseDamageEffects"))
 	TArray<FGameplayTag> DamageEffectTags;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Damage", meta=(EditCondition="bUseDamageEffects"))
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Damage", meta=(EditCondition="bUseDamageEffects", AssetBundles="Gameplay"))
 	TArray<TSoftClassPtr<UGameplayEffect>> DamageEffects;
 
 	/** Switch movement set while this weapon is equipped (drive anim sets via tag). */
@@ -67,7 +67,7 @@ public:
 	bool bHasSkeletalVariant = false;
 
 	/** Skeletal version of the weapon (for slide/bolt/hammer animations, etc.) */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Meshes", meta=(EditCondition="bHasSkeletalVariant"))
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Weapon|Meshes", meta=(EditCondition="bHasSkeletalVariant", AssetBundles="World"))
 	TSoftObjectPtr<USkeletalMesh> SkeletalMesh;
 
 	/** Optional AnimInstance class for the skeletal variant. */
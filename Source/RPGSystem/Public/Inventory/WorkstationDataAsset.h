@@ -17,6 +17,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Workstation")
 	TArray<TSoftObjectPtr<UCraftingRecipeDataAsset>> AllowedRecipes;
 
+	/** Hashed lookup through URecipeCatalogSubsystem when it exists; a linear walk otherwise. */
 	UFUNCTION(BlueprintCallable, Category="Workstation")
 	bool IsRecipeAllowed(const UCraftingRecipeDataAsset* Recipe) const;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
@@ -5,3 +5,4 @@
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_XP);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_XP_Increment);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_XP_CarryRemainder);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_XPDelta);
@@ -6,19 +6,37 @@
 #include "Net/Serialization/FastArraySerializer.h"
 #include "StatSetDataAsset.h"
 #include "StatProviderInterface.h"
+#include "Stats/RPGStatLayout.h"
 #include "RPGStatComponent.generated.h"
 
 // Forward so our helper can take a pointer without needing the full type yet.
 class URPGStatComponent;
 
-/** Free helper used by FastArray PostReplicated* callbacks (defined in .cpp). */
-RPGSYSTEM_API void RPGStat_NetPostReplicated(URPGStatComponent* Owner);
+enum class ERPGStatKind : uint8 { Scalar, Vital, Skill };
+
+/** Free helpers used by the FastArray replication callbacks (defined in .cpp). */
+RPGSYSTEM_API void RPGStat_NetEntriesReplicated(URPGStatComponent* Owner, ERPGStatKind Kind, TConstArrayView<int32> Indices, bool bAdded);
+RPGSYSTEM_API void RPGStat_NetEntriesRemoved(URPGStatComponent* Owner, ERPGStatKind Kind);
+RPGSYSTEM_API void RPGStat_NetReceived(URPGStatComponent* Owner, ERPGStatKind Kind);
 
 // ---------- UI Events ----------
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnScalarChanged, FGameplayTag, Tag, float, NewValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnVitalChanged,  FGameplayTag, Tag, float, NewCurrent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSkillChanged, FGameplayTag, Tag, int32, NewLevel, float, NewXP);
 
+/** After the per-stat events: once per batch on the server, once per replicated list update on clients. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatsChanged, const TArray<FGameplayTag>&, ChangedTags);
+
+/** One entry of a batched stat change: a delta for ApplyStatDeltas, an absolute value for SetStats. */
+USTRUCT(BlueprintType)
+struct RPGSYSTEM_API FRPGStatDelta
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite) FGameplayTag Tag;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite) float        Value = 0.f;
+};
+
 // ---------- FastArray Items ----------
 USTRUCT()
 struct RPGSYSTEM_API FRPGScalarEntry : public FFastArraySerializerItem
@@ -63,10 +81,12 @@ struct RPGSYSTEM_API FRPGScalarList : public FFastArraySerializer
 		return FFastArraySerializer::FastArrayDeltaSerialize<FRPGScalarEntry, FRPGScalarList>(Items, DeltaParms, *this);
 	}
 
-	// Use helper so we don't need the full component type here.
-	void PostReplicatedAdd   (const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
-	void PostReplicatedChange(const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
-	void PostReplicatedRemove(const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
+	// Use helpers so we don't need the full component type here. Only the entries that changed are
+	// re-indexed and broadcast.
+	void PostReplicatedAdd   (const TArrayView<int32>& Indices, int32) { RPGStat_NetEntriesReplicated(Owner, ERPGStatKind::Scalar, Indices, true); }
+	void PostReplicatedChange(const TArrayView<int32>& Indices, int32) { RPGStat_NetEntriesReplicated(Owner, ERPGStatKind::Scalar, Indices, false); }
+	void PreReplicatedRemove (const TArrayView<int32>&, int32)         { RPGStat_NetEntriesRemoved(Owner, ERPGStatKind::Scalar); }
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters&) { RPGStat_NetReceived(Owner, ERPGStatKind::Scalar); }
 };
 template<> struct TStructOpsTypeTraits<FRPGScalarList> : public TStructOpsTypeTraitsBase2<FRPGScalarList> { enum { WithNetDeltaSerializer = true, WithNetSharedSerialization = true }; };
 
@@ -85,9 +105,10 @@ struct RPGSYSTEM_API FRPGVitalList : public FFastArraySerializer
 		return FFastArraySerializer::FastArrayDeltaSerialize<FRPGVitalEntry, FRPGVitalList>(Items, DeltaParms, *this);
 	}
 
-	void PostReplicatedAdd   (const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
-	void PostReplicatedChange(const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
-	void PostReplicatedRemove(const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
+	void PostReplicatedAdd   (const TArrayView<int32>& Indices, int32) { RPGStat_NetEntriesReplicated(Owner, ERPGStatKind::Vital, Indices, true); }
+	void PostReplicatedChange(const TArrayView<int32>& Indices, int32) { RPGStat_NetEntriesReplicated(Owner, ERPGStatKind::Vital, Indices, false); }
+	void PreReplicatedRemove (const TArrayView<int32>&, int32)         { RPGStat_NetEntriesRemoved(Owner, ERPGStatKind::Vital); }
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters&) { RPGStat_NetReceived(Owner, ERPGStatKind::Vital); }
 };
 template<> struct TStructOpsTypeTraits<FRPGVitalList> : public TStructOpsTypeTraitsBase2<FRPGVitalList> { enum { WithNetDeltaSerializer = true, WithNetSharedSerialization = true }; };
 
@@ -106,9 +127,10 @@ struct RPGSYSTEM_API FRPGSkillList : public FFastArraySerializer
 		return FFastArraySerializer::FastArrayDeltaSerialize<FRPGSkillEntry, FRPGSkillList>(Items, DeltaParms, *this);
 	}
 
-	void PostReplicatedAdd   (const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
-	void PostReplicatedChange(const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
-	void PostReplicatedRemove(const TArrayView<int32>&, int32) { RPGStat_NetPostReplicated(Owner); }
+	void PostReplicatedAdd   (const TArrayView<int32>& Indices, int32) { RPGStat_NetEntriesReplicated(Owner, ERPGStatKind::Skill, Indices, true); }
+	void PostReplicatedChange(const TArrayView<int32>& Indices, int32) { RPGStat_NetEntriesReplicated(Owner, ERPGStatKind::Skill, Indices, false); }
+	void PreReplicatedRemove (const TArrayView<int32>&, int32)         { RPGStat_NetEntriesRemoved(Owner, ERPGStatKind::Skill); }
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters&) { RPGStat_NetReceived(Owner, ERPGStatKind::Skill); }
 };
 template<> struct TStructOpsTypeTraits<FRPGSkillList> : public TStructOpsTypeTraitsBase2<FRPGSkillList> { enum { WithNetDeltaSerializer = true, WithNetSharedSerialization = true }; };
 
@@ -125,14 +147,42 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Stats|Setup")
 	TArray<TObjectPtr<UStatSetDataAsset>> InitialStatSets;
 
-	/** Rebuilds caches & broadcasts changes; callable by FastArray helpers. */
+	/** Re-indexes every entry against the layout and broadcasts every stat. */
 	void RebuildCaches();
 
-	/** Re/initializes from InitialStatSets. bClearExisting: wipe before apply. */
+	// ---- Replication callbacks (through the RPGStat_Net* helpers) ----
+	/** Added or changed entries of one kind: noted (and, for adds, the kind marked stale) until the update is received. */
+	void HandleEntriesReplicated(ERPGStatKind Kind, TConstArrayView<int32> Indices, bool bAdded);
+
+	/** Entries are about to be removed; that kind's indices are refreshed once the update is applied. */
+	void HandleEntriesRemoved(ERPGStatKind Kind) { StaleSlots |= KindBit(Kind); }
+
+	/** The whole update is applied: re-indexes a stale kind once, then broadcasts the noted entries. */
+	void HandleReplicationReceived(ERPGStatKind Kind);
+
+	/**
+	 * Re/initializes from StatSets then InitialStatSets, through their shared compiled layout.
+	 * bClearExisting: every stat restarts at its default; otherwise stats already present keep their values.
+	 */
 	UFUNCTION(BlueprintCallable, Category="Stats|Setup")
 	void InitializeFromStatSets(bool bClearExisting);
 
 
+	// ---- Batches ----
+	/**
+	 * Applies many changes in one pass: deltas to the same stat are summed (absolute values: the last
+	 * wins), so each stat is clamped / levelled once and marked dirty once. Its own event fires once,
+	 * after the whole batch is applied, followed by a single OnStatsChanged. SetStat and AddToStat are
+	 * one-entry batches.
+	 */
+	void ApplyStatChanges(TConstArrayView<FRPGStatDelta> Changes, bool bAbsolute);
+
+	UFUNCTION(BlueprintCallable, Category="Stats|Batch")
+	void ApplyStatDeltas(const TArray<FRPGStatDelta>& Deltas) { ApplyStatChanges(Deltas, false); }
+
+	UFUNCTION(BlueprintCallable, Category="Stats|Batch")
+	void SetStats(const TArray<FRPGStatDelta>& Values) { ApplyStatChanges(Values, true); }
+
 	// ---- IStatProviderInterface (BlueprintNativeEvent) ----
 	virtual float GetStat_Implementation(FGameplayTag Tag, float DefaultValue) const override;
 	virtual void  SetStat_Implementation(FGameplayTag Tag, float NewValue)      override;
@@ -145,6 +195,7 @@ public:
 	UPROPERTY(BlueprintAssignable) FOnScalarChanged OnScalarChanged;
 	UPROPERTY(BlueprintAssignable) FOnVitalChanged  OnVitalChanged;
 	UPROPERTY(BlueprintAssignable) FOnSkillChanged  OnSkillChanged;
+	UPROPERTY(BlueprintAssignable) FOnStatsChanged  OnStatsChanged;
 
 protected:
 	/** If true (default), the component will automatically call InitializeFromStatSets() at BeginPlay when it has valid StatSets. */
@@ -164,15 +215,65 @@ protected:
 	UPROPERTY(Replicated) FRPGVitalList  Vitals;
 	UPROPERTY(Replicated) FRPGSkillList  Skills;
 
-	// ---- Tag -> index caches ----
-	UPROPERTY(Transient) TMap<FGameplayTag, int32> ScalarIndex;
-	UPROPERTY(Transient) TMap<FGameplayTag, int32> VitalIndex;
-	UPROPERTY(Transient) TMap<FGameplayTag, int32> SkillIndex;
+	// ---- Layout ----
+	/** Tag -> dense index, shared with every component built from the same sets. */
+	TSharedPtr<const FRPGStatLayout> Layout;
+
+	/**
+	 * Layout index -> entry index, only for a client whose replicated entries arrived in another order.
+	 * Empty (the norm: the server writes entries in layout order) means the indices are the same.
+	 */
+	TArray<int32> ScalarSlots;
+	TArray<int32> VitalSlots;
+	TArray<int32> SkillSlots;
+
+	/** Kinds whose slots need a refresh after a replicated add or removal. */
+	uint8 StaleSlots = 0;
+
+	/** Per kind: tags added or changed by the update being received, broadcast once it is applied. */
+	TArray<FGameplayTag> PendingReplicatedTags[3];
+	static uint8 KindBit(ERPGStatKind Kind) { return uint8(1) << static_cast<uint8>(Kind); }
 
 	// ---- Helpers ----
-	int32 FindScalarIdx(FGameplayTag Tag) const { if (const int32* F = ScalarIndex.Find(Tag)) return *F; return INDEX_NONE; }
-	int32 FindVitalIdx (FGameplayTag Tag) const { if (const int32* F = VitalIndex .Find(Tag)) return *F; return INDEX_NONE; }
-	int32 FindSkillIdx (FGameplayTag Tag) const { if (const int32* F = SkillIndex .Find(Tag)) return *F; return INDEX_NONE; }
+	int32 FindScalarIdx(FGameplayTag Tag) const { return Layout ? ToEntryIdx(ScalarSlots, Layout->FindScalar(Tag), ScalarStats.Items.Num()) : INDEX_NONE; }
+	int32 FindVitalIdx (FGameplayTag Tag) const { return Layout ? ToEntryIdx(VitalSlots,  Layout->FindVital (Tag), Vitals.Items.Num())      : INDEX_NONE; }
+	int32 FindSkillIdx (FGameplayTag Tag) const { return Layout ? ToEntryIdx(SkillSlots,  Layout->FindSkill (Tag), Skills.Items.Num())      : INDEX_NONE; }
+	int32 FindEntryIdx(ERPGStatKind Kind, FGameplayTag Tag) const
+	{
+		switch (Kind)
+		{
+		case ERPGStatKind::Scalar: return FindScalarIdx(Tag);
+		case ERPGStatKind::Vital:  return FindVitalIdx(Tag);
+		case ERPGStatKind::Skill:  return FindSkillIdx(Tag);
+		}
+		return INDEX_NONE;
+	}
+
+	/** Bounded by NumEntries: a client may hold fewer entries than its layout describes. */
+	static int32 ToEntryIdx(const TArray<int32>& Slots, int32 LayoutIdx, int32 NumEntries)
+	{
+		const int32 Idx = (LayoutIdx == INDEX_NONE || Slots.Num() == 0) ? LayoutIdx : Slots[LayoutIdx];
+		return Idx < NumEntries ? Idx : INDEX_NONE;
+	}
+
+	/** StatSets then InitialStatSets, as the layout key. */
+	TArray<const UStatSetDataAsset*, TInlineAllocator<8>> GatherStatSets() const;
+
+	/** Fills one kind's slot remap; false when an entry's tag isn't in the layout at all. */
+	bool MapSlots(ERPGStatKind Kind);
+	bool MapEntriesToLayout();
+
+	/** Compiles the layout if needed and maps Kind (every kind, when Kind is unset) to it. */
+	void RefreshSlots(TOptional<ERPGStatKind> Kind = {});
+
+	void BroadcastEntry(ERPGStatKind Kind, int32 Index) const;
+	FGameplayTag GetEntryTag(ERPGStatKind Kind, int32 Index) const;
+
+	/** Scalars first, then vitals, then skills, as GetStat resolves a tag. */
+	bool FindEntry(const FGameplayTag& Tag, ERPGStatKind& OutKind, int32& OutIndex) const;
+
+	/** Sets (bAbsolute) or adds Value to one entry and marks it dirty; false if nothing changed. No broadcast. */
+	bool ApplyToEntry(ERPGStatKind Kind, int32 Index, float Value, bool bAbsolute);
 
 	void BroadcastScalar(const FRPGScalarEntry& E) const { OnScalarChanged.Broadcast(E.Tag, E.Value); }
 	void BroadcastVital (const FRPGVitalEntry&  E) const { OnVitalChanged .Broadcast(E.Tag, E.Current); }
@@ -0,0 +1,45 @@
+// RPGStatLayout.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Stats/StatSetDataAsset.h"
+
+/**
+ * Immutable runtime form of a list of UStatSetDataAssets: every scalar, vital and skill tag mapped to
+ * a dense index, with its defaults. Compiled once per distinct list and shared by every
+ * URPGStatComponent using that list, so a component only holds its values and a pointer to this.
+ */
+struct RPGSYSTEM_API FRPGStatLayout
+{
+	/** Dense definitions; a component's value arrays are indexed the same way. */
+	TArray<FRPGScalarDef> Scalars;
+	TArray<FRPGVitalDef>  Vitals;
+	TArray<FRPGSkillDef>  Skills;
+
+	int32 FindScalar(const FGameplayTag& Tag) const { const int32* F = ScalarIndex.Find(Tag); return F ? *F : INDEX_NONE; }
+	int32 FindVital (const FGameplayTag& Tag) const { const int32* F = VitalIndex .Find(Tag); return F ? *F : INDEX_NONE; }
+	int32 FindSkill (const FGameplayTag& Tag) const { const int32* F = SkillIndex .Find(Tag); return F ? *F : INDEX_NONE; }
+
+	/**
+	 * The shared layout for Sets, in order; null entries are skipped. A tag defined by several sets keeps
+	 * its first position and takes the last set's defaults. Game thread only.
+	 */
+	static TSharedRef<const FRPGStatLayout> Get(TConstArrayView<const UStatSetDataAsset*> Sets);
+
+	/** Drops the cached layouts built from Set (editor changes). Components keep the one they hold until re-initialized. */
+	static void Invalidate(const UStatSetDataAsset* Set);
+
+	/** Unshared layout of just these tags, for a replicated component whose entries its own sets don't describe. */
+	static TSharedRef<const FRPGStatLayout> FromTags(TConstArrayView<FGameplayTag> ScalarTags, TConstArrayView<FGameplayTag> VitalTags, TConstArrayView<FGameplayTag> SkillTags);
+
+private:
+	TMap<FGameplayTag, int32> ScalarIndex;
+	TMap<FGameplayTag, int32> VitalIndex;
+	TMap<FGameplayTag, int32> SkillIndex;
+
+	void Merge(const UStatSetDataAsset& Set);
+
+	template<typename TDef>
+	static void MergeDef(TArray<TDef>& Defs, TMap<FGameplayTag, int32>& Index, const TDef& Def);
+};
@@ -50,4 +50,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly) TArray<FRPGScalarDef> Modifiers;
 	UPROPERTY(EditAnywhere, BlueprintReadOnly) TArray<FRPGVitalDef>  Vitals;
 	UPROPERTY(EditAnywhere, BlueprintReadOnly) TArray<FRPGSkillDef>  Skills;
+
+#if WITH_EDITOR
+	/** Drops the compiled layouts built from this set. */
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
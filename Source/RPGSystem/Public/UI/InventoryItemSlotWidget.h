@@ -8,6 +8,7 @@ class UInventoryComponent;
 class UItemDataAsset;
 class UInventoryDragDropOp;
 class UInventoryPanelWidget;
+struct FStreamableHandle;
 
 /** One visual slot; binds to an inventory/index and self-updates. */
 UCLASS(Blueprintable, Abstract)
@@ -121,7 +122,12 @@ private:
 	UFUNCTION() void HandleInvChanged();
 
 	void UpdateFromInventory();
+
+	/** Resident data only; a cold item is streamed in by UpdateFromInventory. */
 	UItemDataAsset* ResolveItemData() const;
 
 	TWeakObjectPtr<UInventoryPanelWidget> CachedPanel;
+
+	/** Keeps the shown item resident; replaced when the slot changes. */
+	TSharedPtr<FStreamableHandle> ItemDataLoad;
 };
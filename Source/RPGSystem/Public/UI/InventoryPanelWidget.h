@@ -2,12 +2,14 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Inventory/ItemResidencySubsystem.h"
 #include "InventoryPanelWidget.generated.h"
 
 class UPanelWidget;
 class UInventoryComponent;
 class UItemDataAsset;
 class UInventoryItemSlotWidget;
+struct FStreamableHandle;
 
 /** Reusable inventory view; spawns/binds slot widgets and listens for component events. */
 UCLASS(Blueprintable)
@@ -77,6 +79,17 @@ private:
 	void BindInventory(UInventoryComponent* InInventory);
 	void UnbindInventory();
 	void EnsureSlotWidgets(int32 DesiredCount);
-	void QuerySlotData(int32 SlotIndex, UItemDataAsset*& OutData, int32& OutQty) const;
+	/** Resident data only; returns false when the slot holds an item that still has to stream in. */
+	bool QuerySlotData(int32 SlotIndex, UItemDataAsset*& OutData, int32& OutQty) const;
+
+	/** One batched request for the cold items of SlotIndices; those slots refresh when it lands. */
+	void StreamSlots(const TArray<int32>& SlotIndices);
+
+	TSharedPtr<FStreamableHandle> PendingSlotLoad;
+
+	/** Items shown by the UI slots stay cached while the panel is bound. */
+	FItemResidencyPinSet SlotPins;
+	void PinShownItems();
+
 	bool TryAutoPlaceDrag(class UInventoryComponent* TargetInv, class UDragDropOperation* Op);
 };